@@ -0,0 +1,212 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Measures atomic updates under contention, as in particle deposition or
+/// binning loops: every thread updates one of a number of hot slots, each on
+/// its own cache line. Sweeps the thread count and the number of slots, and
+/// compares builtin_atomic and omp_atomic with a plain CAS loop. Also
+/// compares atomic views with privatized_atomic views on a scatter-add from
+/// elements onto nodes.
+///
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+const int max_slots = 4096;
+const int updates_per_iteration = 256;
+
+template <typename T>
+struct alignas(64) Slot {
+  T value;
+};
+
+template <typename T>
+static Slot<T>* slots()
+{
+  static std::vector<Slot<T>> s(max_slots, Slot<T>{T(0)});
+  return s.data();
+}
+
+// gives each thread a different first slot
+static int next_offset()
+{
+  static std::atomic<int> next{0};
+  return next.fetch_add(97) % max_slots;
+}
+
+// the compare and swap loop without backoff that all operations used to go
+// through; RAJA policies are found by argument dependent lookup
+struct plain_cas {
+};
+
+template <typename T>
+using cas_bits = typename std::
+    conditional<sizeof(T) == 8, unsigned long long, unsigned>::type;
+
+template <typename T, typename Oper>
+static T plain_cas_oper(T volatile* acc, Oper&& oper)
+{
+  cas_bits<T>* bits = (cas_bits<T>*)acc;
+  cas_bits<T> old = *bits;
+  T old_value = RAJA::util::reinterp_A_as_B<cas_bits<T>, T>(old);
+  while (!__atomic_compare_exchange_n(
+      bits,
+      &old,
+      RAJA::util::reinterp_A_as_B<T, cas_bits<T>>(oper(old_value)),
+      false,
+      __ATOMIC_ACQ_REL,
+      __ATOMIC_RELAXED)) {
+    old_value = RAJA::util::reinterp_A_as_B<cas_bits<T>, T>(old);
+  }
+  return old_value;
+}
+
+template <typename T>
+static T atomicAdd(plain_cas, T volatile* acc, T value)
+{
+  return plain_cas_oper(acc, [=](T a) { return a + value; });
+}
+
+template <typename T>
+static T atomicMax(plain_cas, T volatile* acc, T value)
+{
+  if (*acc > value) {
+    return *acc;
+  }
+  return plain_cas_oper(acc, [=](T a) { return a > value ? a : value; });
+}
+
+template <typename AtomicPol, typename T>
+static void benchmark_atomic_add(benchmark::State& state)
+{
+  const int num_slots = state.range(0);
+  Slot<T>* s = slots<T>();
+  int slot = next_offset() % num_slots;
+  while (state.KeepRunning()) {
+    for (int i = 0; i < updates_per_iteration; ++i) {
+      atomicAdd(AtomicPol{}, &s[slot].value, T(1));
+      slot = slot + 1 == num_slots ? 0 : slot + 1;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * updates_per_iteration);
+}
+
+// values grow as in a running maximum, each run starting above the values
+// left in the slots by earlier runs so that updates do write
+static std::atomic<long long> max_values_used{0};
+
+template <typename AtomicPol, typename T>
+static void benchmark_atomic_max(benchmark::State& state)
+{
+  const int num_slots = state.range(0);
+  Slot<T>* s = slots<T>();
+  int slot = next_offset() % num_slots;
+  T value(max_values_used.load());
+  while (state.KeepRunning()) {
+    for (int i = 0; i < updates_per_iteration; ++i) {
+      atomicMax(AtomicPol{}, &s[slot].value, value);
+      value += T(1);
+      slot = slot + 1 == num_slots ? 0 : slot + 1;
+    }
+  }
+  max_values_used += state.iterations() * updates_per_iteration;
+  state.SetItemsProcessed(state.iterations() * updates_per_iteration);
+}
+
+static void contention_args(benchmark::internal::Benchmark* b)
+{
+  for (int num_slots : {1, 8, 64, max_slots}) {
+    b->Arg(num_slots);
+  }
+  b->ThreadRange(1, 128)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_atomic_add, plain_cas, double)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::atomic::builtin_atomic, double)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_add, plain_cas, long long)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_add,
+                   RAJA::atomic::builtin_atomic,
+                   long long)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_max, plain_cas, double)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_max, RAJA::atomic::builtin_atomic, double)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_max, plain_cas, long long)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_max,
+                   RAJA::atomic::builtin_atomic,
+                   long long)
+    ->Apply(contention_args);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using scatter_exec = RAJA::omp_parallel_for_exec;
+#else
+using scatter_exec = RAJA::seq_exec;
+#endif
+
+// each element of a 2D mesh of n x n elements adds to its four nodes
+template <typename AtomicPol>
+static void benchmark_scatter_add(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> nodes((n + 1) * (n + 1), 0.0);
+  RAJA::View<double, RAJA::Layout<2>> node_view(nodes.data(), n + 1, n + 1);
+  auto atomic_nodes = RAJA::make_atomic_view<AtomicPol>(node_view);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<scatter_exec>(RAJA::RangeSegment(0, n * n), [=](int e) {
+      const int i = e / n;
+      const int j = e % n;
+      atomic_nodes(i, j) += 0.25;
+      atomic_nodes(i, j + 1) += 0.25;
+      atomic_nodes(i + 1, j) += 0.25;
+      atomic_nodes(i + 1, j + 1) += 0.25;
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_scatter_add, RAJA::atomic::auto_atomic)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(benchmark_scatter_add,
+                   RAJA::atomic::privatized_atomic<RAJA::atomic::auto_atomic,
+                                                   64>)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(benchmark_scatter_add,
+                   RAJA::atomic::privatized_atomic<RAJA::atomic::auto_atomic>)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(benchmark_scatter_add,
+                   RAJA::atomic::privatized_atomic<RAJA::atomic::auto_atomic,
+                                                   4096>)
+    ->Arg(1000);
+
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::atomic::omp_atomic, double)
+    ->Apply(contention_args);
+BENCHMARK_TEMPLATE(benchmark_atomic_add, RAJA::atomic::omp_atomic, long long)
+    ->Apply(contention_args);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares segment iteration policies on index sets whose segments differ
+/// in length by orders of magnitude: one long RangeSegment followed by many
+/// short ListSegments, as after remeshing. Argument is the number of short
+/// segments; the loop is repeated as in timesteps.
+///
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+using RangeListIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                              RAJA::ListSegment>;
+
+const int range_length = 1 << 20;
+const int list_length = 64;
+
+template <typename SegIt>
+static void benchmark_segit(benchmark::State& state)
+{
+  const int num_lists = state.range(0);
+  std::vector<RAJA::Index_type> idx(num_lists * list_length);
+  for (size_t i = 0; i < idx.size(); ++i) {
+    idx[i] = range_length + 2 * i;
+  }
+
+  RangeListIndexSet iset;
+  iset.push_back(RAJA::RangeSegment(0, range_length));
+  for (int l = 0; l < num_lists; ++l) {
+    iset.push_back(RAJA::ListSegment(&idx[l * list_length],
+                                     list_length,
+                                     RAJA::Unowned));
+  }
+
+  std::vector<double> value(range_length + 2 * idx.size(), 1.0);
+  double* v = value.data();
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::ExecPolicy<SegIt, RAJA::simd_exec>>(
+        iset, [=](RAJA::Index_type i) { v[i] = v[i] * 0.999 + 0.001; });
+  }
+  benchmark::DoNotOptimize(value.data());
+  state.SetItemsProcessed(state.iterations() * iset.getLength());
+}
+
+static void segment_counts(benchmark::internal::Benchmark* b)
+{
+  for (int num_lists : {16, 1024, 16384}) {
+    b->Arg(num_lists);
+  }
+  b->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_segit, RAJA::omp_parallel_for_segit)
+    ->Apply(segment_counts);
+BENCHMARK_TEMPLATE(benchmark_segit, RAJA::omp_parallel_for_dynamic<1>)
+    ->Apply(segment_counts);
+BENCHMARK_TEMPLATE(benchmark_segit, RAJA::omp_balanced_segit)
+    ->Apply(segment_counts);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares the serial buildIndexSetAligned builder against the parallel
+/// buildTypedIndexSetAligned builder on index arrays like those of meshes
+/// after remeshing.
+///
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+using RangeListIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                              RAJA::ListSegment>;
+using RangeListStrideIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                                    RAJA::ListSegment,
+                                                    RAJA::RangeStrideSegment>;
+
+//
+// Index array of length n; kind 0 has runs of 8 to 512 consecutive indices
+// separated by gaps, kind 1 also has strided runs (e.g. cells of a face of a
+// block), and kind 2 is shuffled.
+//
+static std::vector<RAJA::Index_type> make_indices(int n, int kind)
+{
+  std::vector<RAJA::Index_type> idx;
+  idx.reserve(n);
+  std::mt19937 gen(n);
+  std::uniform_int_distribution<int> run_len(8, 512);
+  RAJA::Index_type next = 0;
+  while (static_cast<int>(idx.size()) < n) {
+    const RAJA::Index_type stride = (kind == 1 && gen() % 2) ? 7 : 1;
+    const int len = std::min<int>(run_len(gen), n - idx.size());
+    for (int i = 0; i < len; ++i) {
+      idx.push_back(next + i * stride);
+    }
+    next += len * stride + gen() % 16;
+  }
+  if (kind == 2) {
+    std::shuffle(idx.begin(), idx.end(), gen);
+  }
+  return idx;
+}
+
+static void benchmark_build_serial(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<RAJA::Index_type> idx = make_indices(n, state.range(1));
+
+  while (state.KeepRunning()) {
+    RangeListIndexSet iset;
+    RAJA::buildIndexSetAligned(iset, idx.data(), n);
+    benchmark::DoNotOptimize(iset.getLength());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_build_parallel(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<RAJA::Index_type> idx = make_indices(n, state.range(1));
+
+  while (state.KeepRunning()) {
+    RangeListStrideIndexSet iset;
+    RAJA::buildTypedIndexSetAligned(iset, idx.data(), n);
+    benchmark::DoNotOptimize(iset.getLength());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void builder_args(benchmark::internal::Benchmark* b)
+{
+  for (int kind = 0; kind < 3; ++kind) {
+    b->Args({1 << 16, kind});
+    b->Args({1 << 22, kind});
+  }
+}
+
+BENCHMARK(benchmark_build_serial)->Apply(builder_args);
+BENCHMARK(benchmark_build_parallel)->Apply(builder_args);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares OpenMP loop schedules on ListSegment loops over zones whose cost
+/// varies, as in adaptively refined meshes. Cost profiles: 0 uniform, 1 cost
+/// growing along the loop, 2 one contiguous refined region costing 16x, and
+/// 3 scattered zones costing 16x. The runtime schedule policy uses
+/// OMP_SCHEDULE.
+///
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+const int num_zones = 1 << 16;
+const int base_work = 16;
+
+// work per zone of each cost profile, in units of base_work
+static std::vector<int> make_costs(int profile)
+{
+  std::vector<int> cost(num_zones, 1);
+  std::mt19937 gen(profile);
+  for (int z = 0; z < num_zones; ++z) {
+    switch (profile) {
+      case 1:
+        cost[z] = 1 + 16 * z / num_zones;
+        break;
+      case 2:
+        cost[z] = (z >= num_zones / 8 && z < num_zones / 4) ? 16 : 1;
+        break;
+      case 3:
+        cost[z] = gen() % 8 == 0 ? 16 : 1;
+        break;
+      default:
+        break;
+    }
+  }
+  return cost;
+}
+
+template <typename ExecPol>
+static void benchmark_schedule(benchmark::State& state)
+{
+  std::vector<int> cost = make_costs(state.range(0));
+  std::vector<RAJA::Index_type> idx(num_zones);
+  for (int z = 0; z < num_zones; ++z) {
+    idx[z] = z;
+  }
+  RAJA::ListSegment zones(idx.data(), num_zones);
+  std::vector<double> value(num_zones, 1.0);
+  const int* c = cost.data();
+  double* v = value.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(zones, [=](RAJA::Index_type z) {
+      double x = v[z];
+      for (int k = 0; k < base_work * c[z]; ++k) {
+        x = x * 0.999 + 0.001;
+      }
+      v[z] = x;
+    });
+  }
+  benchmark::DoNotOptimize(value.data());
+  state.SetItemsProcessed(state.iterations() * num_zones);
+}
+
+static void profiles(benchmark::internal::Benchmark* b)
+{
+  for (int profile = 0; profile < 4; ++profile) {
+    b->Arg(profile);
+  }
+  b->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_exec)
+    ->Apply(profiles);
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_static<16>)
+    ->Apply(profiles);
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_dynamic<1>)
+    ->Apply(profiles);
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_dynamic<64>)
+    ->Apply(profiles);
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_guided<16>)
+    ->Apply(profiles);
+BENCHMARK_TEMPLATE(benchmark_schedule, RAJA::omp_parallel_for_runtime)
+    ->Apply(profiles);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Runs a sequence of short loops, as in one step of a hydro code, with a
+/// parallel region per loop, in one omp_fused_region with a barrier after
+/// every loop, and in one omp_fused_region with barriers only where loops
+/// depend on each other.
+///
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+const int num_loops = 40;
+
+struct StepData {
+  std::vector<double> a;
+  std::vector<double> b;
+  explicit StepData(int n) : a(n, 1.0), b(n, 0.0) {}
+};
+
+// loops alternate between updating a from b and b from a at the same
+// index; every tenth loop reads neighbors and so depends on all threads
+template <typename LoopPol, typename Sync>
+static void step(double* a, double* b, int n, Sync&& sync)
+{
+  for (int l = 0; l < num_loops; ++l) {
+    if (l % 10 == 9) {
+      sync();
+      RAJA::forall<LoopPol>(RAJA::RangeSegment(1, n - 1), [=](int i) {
+        b[i] = 0.25 * (a[i - 1] + 2.0 * a[i] + a[i + 1]);
+      });
+      sync();
+    } else if (l % 2) {
+      RAJA::forall<LoopPol>(RAJA::RangeSegment(0, n),
+                            [=](int i) { a[i] = 0.5 * b[i] + 1.0; });
+    } else {
+      RAJA::forall<LoopPol>(RAJA::RangeSegment(0, n),
+                            [=](int i) { b[i] = 0.5 * a[i] + 1.0; });
+    }
+  }
+}
+
+static void benchmark_region_per_loop(benchmark::State& state)
+{
+  const int n = state.range(0);
+  StepData d(n);
+  double* a = d.a.data();
+  double* b = d.b.data();
+  while (state.KeepRunning()) {
+    step<RAJA::omp_parallel_for_stable<>>(a, b, n, [] {});
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops * n);
+}
+
+static void benchmark_fused_region(benchmark::State& state)
+{
+  const int n = state.range(0);
+  StepData d(n);
+  double* a = d.a.data();
+  double* b = d.b.data();
+  while (state.KeepRunning()) {
+    RAJA::region<RAJA::omp_fused_region>([=]() {
+      step<RAJA::omp_parallel_for_stable<>>(a, b, n, [] {});
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops * n);
+}
+
+static void benchmark_fused_region_nowait(benchmark::State& state)
+{
+  const int n = state.range(0);
+  StepData d(n);
+  double* a = d.a.data();
+  double* b = d.b.data();
+  while (state.KeepRunning()) {
+    RAJA::region<RAJA::omp_fused_region>([=]() {
+      step<RAJA::omp_for_stable_nowait<>>(a, b, n, [] {
+        RAJA::region_sync<RAJA::omp_fused_region>();
+      });
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops * n);
+}
+
+BENCHMARK(benchmark_region_per_loop)->Range(1 << 12, 1 << 18);
+BENCHMARK(benchmark_fused_region)->Range(1 << 12, 1 << 18);
+BENCHMARK(benchmark_fused_region_nowait)->Range(1 << 12, 1 << 18);
+
+BENCHMARK_MAIN();
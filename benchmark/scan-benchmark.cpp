@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares the single-pass OpenMP scan against the two-pass scheme it
+/// replaced (reproduced below) and against the sequential scan.
+///
+
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Previous OpenMP scan: local scan of each thread's block, serial scan of
+// the block sums, then a second pass adding each block's offset. The
+// out-of-place version first copies the input to the output.
+//
+template <typename T>
+static void two_pass_inclusive(const T* in, T* out, int n)
+{
+  std::copy(in, in + n, out);
+  const int p0 = std::min(n, omp_get_max_threads());
+  std::vector<T> sums(p0, T());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const int i0 = (static_cast<size_t>(n) * pid) / p;
+    const int i1 = (static_cast<size_t>(n) * (pid + 1)) / p;
+    for (int i = i0 + 1; i < i1; ++i) {
+      out[i] += out[i - 1];
+    }
+    sums[pid] = out[i1 - 1];
+#pragma omp barrier
+#pragma omp single
+    {
+      T agg = T();
+      for (int i = 0; i < p; ++i) {
+        T t = sums[i];
+        sums[i] = agg;
+        agg += t;
+      }
+    }
+    for (int i = i0; i < i1; ++i) {
+      out[i] += sums[pid];
+    }
+  }
+}
+
+template <typename T>
+struct ScanData {
+  std::vector<T> in;
+  std::vector<T> out;
+  explicit ScanData(int n) : in(n), out(n)
+  {
+    for (int i = 0; i < n; ++i) {
+      in[i] = static_cast<T>(i % 7);
+    }
+  }
+};
+
+static void benchmark_scan_two_pass(benchmark::State& state)
+{
+  const int n = state.range(0);
+  ScanData<double> d(n);
+  while (state.KeepRunning()) {
+    two_pass_inclusive(d.in.data(), d.out.data(), n);
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(double));
+}
+
+static void benchmark_scan_omp(benchmark::State& state)
+{
+  const int n = state.range(0);
+  ScanData<double> d(n);
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<RAJA::omp_parallel_for_exec>(d.in.data(),
+                                                      d.in.data() + n,
+                                                      d.out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(double));
+}
+
+static void benchmark_scan_omp_inplace(benchmark::State& state)
+{
+  const int n = state.range(0);
+  ScanData<double> d(n);
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan_inplace<RAJA::omp_parallel_for_exec>(d.out.data(),
+                                                              d.out.data()
+                                                                  + n);
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(double));
+}
+
+static void benchmark_scan_seq(benchmark::State& state)
+{
+  const int n = state.range(0);
+  ScanData<double> d(n);
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<RAJA::seq_exec>(d.in.data(),
+                                         d.in.data() + n,
+                                         d.out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * sizeof(double));
+}
+
+BENCHMARK(benchmark_scan_two_pass)->Range(1 << 16, 1 << 26);
+BENCHMARK(benchmark_scan_omp)->Range(1 << 16, 1 << 26);
+BENCHMARK(benchmark_scan_omp_inplace)->Range(1 << 16, 1 << 26);
+BENCHMARK(benchmark_scan_seq)->Range(1 << 16, 1 << 26);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,177 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares kernel tiling with tile sizes derived from the cache sizes
+/// (tile_cache) against hand-picked tile_fixed sizes, on a matrix transpose
+/// and on the LTimes kernel from examples/ltimes.cpp.
+///
+
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+using namespace RAJA::statement;
+
+//
+// Transpose of an N x N matrix, tiling both loops with the same policy.
+//
+template <typename TPol>
+static void transpose(benchmark::State& state)
+{
+  using Pol = RAJA::KernelPolicy<
+      Tile<1,
+           TPol,
+           RAJA::loop_exec,
+           Tile<0,
+                TPol,
+                RAJA::loop_exec,
+                For<1, RAJA::loop_exec, For<0, RAJA::loop_exec, Lambda<0>>>>>>;
+
+  const int n = state.range(0);
+  std::vector<double> a(n * n, 1.0), b(n * n);
+  const double* pa = a.data();
+  double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                       RAJA::RangeSegment(0, n)),
+                      [=](RAJA::Index_type i, RAJA::Index_type j) {
+                        pb[j * n + i] = pa[i * n + j];
+                      });
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+
+static void benchmark_transpose_untiled(benchmark::State& state)
+{
+  transpose<tile_fixed<1 << 30>>(state);
+}
+static void benchmark_transpose_fixed_16(benchmark::State& state)
+{
+  transpose<tile_fixed<16>>(state);
+}
+static void benchmark_transpose_fixed_32(benchmark::State& state)
+{
+  transpose<tile_fixed<32>>(state);
+}
+static void benchmark_transpose_fixed_64(benchmark::State& state)
+{
+  transpose<tile_fixed<64>>(state);
+}
+static void benchmark_transpose_cache_L1(benchmark::State& state)
+{
+  transpose<tile_cache<2 * sizeof(double), 2, 1>>(state);
+}
+static void benchmark_transpose_cache_L2(benchmark::State& state)
+{
+  transpose<tile_cache<2 * sizeof(double), 2, 2>>(state);
+}
+
+//
+// LTimes, phi(m, g, z) += L(m, d) * psi(d, g, z), with the z loop tiled so
+// that the psi(:, g, z) and phi(:, g, z) slices of a tile stay in cache
+// while the m and d loops sweep over them.
+//
+const int num_m = 25;
+const int num_d = 80;
+const int num_g = 16;
+
+template <typename TPol>
+static void ltimes(benchmark::State& state)
+{
+  using Pol = RAJA::KernelPolicy<
+      For<2,
+          RAJA::loop_exec,  // g
+          Tile<3,
+               TPol,
+               RAJA::loop_exec,  // z
+               For<0,
+                   RAJA::loop_exec,  // m
+                   For<1,
+                       RAJA::loop_exec,  // d
+                       For<3, RAJA::simd_exec, Lambda<0>>>>>>>;  // z
+
+  const int num_z = state.range(0);
+  std::vector<double> L(num_m * num_d, 0.5);
+  std::vector<double> psi(num_d * num_g * num_z, 2.0);
+  std::vector<double> phi(num_m * num_g * num_z, 0.0);
+  const double* pL = L.data();
+  const double* ppsi = psi.data();
+  double* pphi = phi.data();
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, num_m),
+                                       RAJA::RangeSegment(0, num_d),
+                                       RAJA::RangeSegment(0, num_g),
+                                       RAJA::RangeSegment(0, num_z)),
+                      [=](RAJA::Index_type m,
+                          RAJA::Index_type d,
+                          RAJA::Index_type g,
+                          RAJA::Index_type z) {
+                        pphi[(m * num_g + g) * num_z + z] +=
+                            pL[m * num_d + d]
+                            * ppsi[(d * num_g + g) * num_z + z];
+                      });
+  }
+  state.SetItemsProcessed(state.iterations() * num_m * num_d * num_g
+                          * num_z);
+}
+
+// bytes of psi and phi touched per z point of a tile
+const camp::idx_t ltimes_bytes = (num_m + num_d) * sizeof(double);
+
+static void benchmark_ltimes_untiled(benchmark::State& state)
+{
+  ltimes<tile_fixed<1 << 30>>(state);
+}
+static void benchmark_ltimes_fixed_64(benchmark::State& state)
+{
+  ltimes<tile_fixed<64>>(state);
+}
+static void benchmark_ltimes_fixed_256(benchmark::State& state)
+{
+  ltimes<tile_fixed<256>>(state);
+}
+static void benchmark_ltimes_fixed_1024(benchmark::State& state)
+{
+  ltimes<tile_fixed<1024>>(state);
+}
+static void benchmark_ltimes_cache_L1(benchmark::State& state)
+{
+  ltimes<tile_cache<ltimes_bytes, 1, 1>>(state);
+}
+static void benchmark_ltimes_cache_L2(benchmark::State& state)
+{
+  ltimes<tile_cache<ltimes_bytes, 1, 2>>(state);
+}
+
+BENCHMARK(benchmark_transpose_untiled)->Range(1 << 8, 1 << 12);
+BENCHMARK(benchmark_transpose_fixed_16)->Range(1 << 8, 1 << 12);
+BENCHMARK(benchmark_transpose_fixed_32)->Range(1 << 8, 1 << 12);
+BENCHMARK(benchmark_transpose_fixed_64)->Range(1 << 8, 1 << 12);
+BENCHMARK(benchmark_transpose_cache_L1)->Range(1 << 8, 1 << 12);
+BENCHMARK(benchmark_transpose_cache_L2)->Range(1 << 8, 1 << 12);
+
+BENCHMARK(benchmark_ltimes_untiled)->Range(1 << 12, 1 << 14);
+BENCHMARK(benchmark_ltimes_fixed_64)->Range(1 << 12, 1 << 14);
+BENCHMARK(benchmark_ltimes_fixed_256)->Range(1 << 12, 1 << 14);
+BENCHMARK(benchmark_ltimes_fixed_1024)->Range(1 << 12, 1 << 14);
+BENCHMARK(benchmark_ltimes_cache_L1)->Range(1 << 12, 1 << 14);
+BENCHMARK(benchmark_ltimes_cache_L2)->Range(1 << 12, 1 << 14);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Compares simd_exec, which relies on the compiler to vectorize the loop,
+/// with vector_exec and explicit SIMD registers, on daxpy and on a 2d
+/// 5-point stencil, and on daxpy over list segments.
+///
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+const size_t width = RAJA::simd_native_width<double>::value;
+
+using view_1d = RAJA::View<double, RAJA::Layout<1, RAJA::Index_type, 0>>;
+// stride-one layouts let the compiler see that loads along j are contiguous
+using view_2d = RAJA::View<double, RAJA::Layout<2, RAJA::Index_type, 1>>;
+
+static void benchmark_daxpy_simd(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> x(n, 1.0), y(n, 2.0);
+  view_1d X(x.data(), n), Y(y.data(), n);
+  const double a = 0.5;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, n),
+                                  [=](RAJA::Index_type i) {
+                                    Y(i) += a * X(i);
+                                  });
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_daxpy_vector(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> x(n, 1.0), y(n, 2.0);
+  view_1d X(x.data(), n), Y(y.data(), n);
+  const double a = 0.5;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::vector_exec<width>>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::VectorIndex<RAJA::Index_type, width> i) {
+          Y(i) += a * X(i);
+        });
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_stencil_simd(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> a(n * n, 1.0), b(n * n, 0.0);
+  view_2d A(a.data(), n, n), B(b.data(), n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(1, n - 1), [=](int i) {
+      RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(1, n - 1), [=](RAJA::Index_type j) {
+            B(i, j) = 0.25 * (A(i - 1, j) + A(i + 1, j) + A(i, j - 1)
+                              + A(i, j + 1));
+          });
+    });
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+static void benchmark_stencil_vector(benchmark::State& state)
+{
+  const int n = state.range(0);
+  std::vector<double> a(n * n, 1.0), b(n * n, 0.0);
+  view_2d A(a.data(), n, n), B(b.data(), n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(1, n - 1), [=](int i) {
+      RAJA::forall<RAJA::vector_exec<width>>(
+          RAJA::RangeSegment(1, n - 1),
+          [=](RAJA::VectorIndex<RAJA::Index_type, width> j) {
+            // shifted copies of j load the left and right neighbors
+            RAJA::VectorIndex<RAJA::Index_type, width> jm(j.first - 1,
+                                                          j.size());
+            RAJA::VectorIndex<RAJA::Index_type, width> jp(j.first + 1,
+                                                          j.size());
+            B(i, j) = 0.25 * (A(i - 1, j) + A(i + 1, j) + A(i, jm) + A(i, jp));
+          });
+    });
+    benchmark::DoNotOptimize(b.data());
+  }
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+//
+// daxpy over a ListSegment; the argument selects how the list is built:
+// 0 all indices in order, 1 runs of 16 consecutive indices in shuffled
+// order (as for cells of mesh blocks), 2 all indices shuffled
+//
+static RAJA::ListSegment make_list(int n, int kind)
+{
+  std::vector<RAJA::Index_type> idx(n);
+  for (int i = 0; i < n; ++i) {
+    idx[i] = i;
+  }
+  std::mt19937 gen(n);
+  if (kind == 1) {
+    std::vector<RAJA::Index_type> runs(n / 16);
+    for (size_t r = 0; r < runs.size(); ++r) {
+      runs[r] = 16 * r;
+    }
+    std::shuffle(runs.begin(), runs.end(), gen);
+    for (size_t r = 0; r < runs.size(); ++r) {
+      for (int k = 0; k < 16; ++k) {
+        idx[16 * r + k] = runs[r] + k;
+      }
+    }
+  } else if (kind == 2) {
+    std::shuffle(idx.begin(), idx.end(), gen);
+  }
+  return RAJA::ListSegment(idx.data(), n);
+}
+
+static void benchmark_list_daxpy_simd(benchmark::State& state)
+{
+  const int n = 1 << 16;
+  RAJA::ListSegment list = make_list(n, state.range(0));
+  std::vector<double> x(n, 1.0), y(n, 2.0);
+  view_1d X(x.data(), n), Y(y.data(), n);
+  const double a = 0.5;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::simd_exec>(list, [=](RAJA::Index_type i) {
+      Y(i) += a * X(i);
+    });
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void benchmark_list_daxpy_vector(benchmark::State& state)
+{
+  const int n = 1 << 16;
+  RAJA::ListSegment list = make_list(n, state.range(0));
+  std::vector<double> x(n, 1.0), y(n, 2.0);
+  view_1d X(x.data(), n), Y(y.data(), n);
+  const double a = 0.5;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::vector_exec<width>>(
+        list, [=](RAJA::VectorIndex<RAJA::Index_type, width> i) {
+          Y(i) += a * X(i);
+        });
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(benchmark_daxpy_simd)->Range(1 << 10, 1 << 20);
+BENCHMARK(benchmark_daxpy_vector)->Range(1 << 10, 1 << 20);
+BENCHMARK(benchmark_stencil_simd)->Range(1 << 6, 1 << 11);
+BENCHMARK(benchmark_stencil_vector)->Range(1 << 6, 1 << 11);
+BENCHMARK(benchmark_list_daxpy_simd)->DenseRange(0, 2);
+BENCHMARK(benchmark_list_daxpy_vector)->DenseRange(0, 2);
+
+BENCHMARK_MAIN();
@@ -121,3 +121,4 @@ endif()
 set(RAJA_RANGE_ALIGN 4 CACHE INT "")
 set(RAJA_RANGE_MIN_LENGTH 32 CACHE INT "")
 set(RAJA_DATA_ALIGN 64 CACHE INT "")
+set(RAJA_CACHE_LINE_SIZE 64 CACHE INT "")
@@ -26,7 +26,9 @@
   As RAJA does not manage memory we include a general purpose memory
   manager which may be used to perform c++ style allocation/deallocation
   or allocate/deallocate CUDA unified memory. The type of memory allocated
-  is dependent on how RAJA was configured.
+  is dependent on how RAJA was configured. Host memory is first touched in
+  parallel, so each OpenMP thread's share of an array lands on its own
+  NUMA node.
 */
 namespace memoryManager
 {
@@ -39,7 +41,7 @@ T *allocate(RAJA::Index_type size)
   cudaErrchk(
       cudaMallocManaged((void **)&ptr, sizeof(T) * size, cudaMemAttachGlobal));
 #else
-  ptr = new T[size];
+  ptr = RAJA::first_touch_allocator<T>().allocate(size);
 #endif
   return ptr;
 }
@@ -51,7 +53,7 @@ void deallocate(T *&ptr)
 #if defined(RAJA_ENABLE_CUDA)
     cudaErrchk(cudaFree(ptr));
 #else
-    delete[] ptr;
+    RAJA::first_touch_allocator<T>().deallocate(ptr);
 #endif
     ptr = nullptr;
   }
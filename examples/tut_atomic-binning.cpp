@@ -32,6 +32,7 @@
  *  RAJA features shown:
  *    - `forall` loop iteration template method
  *    - Atomic add
+ *    - Multi-bin sum reduction
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -114,6 +115,25 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
 
   printBins(bins, M);
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n\n Running RAJA OMP binning with multi-reduction" << std::endl;
+  std::memset(bins, 0, M * sizeof(int));
+
+  using REDUCE_POL2 = RAJA::omp_reduce;
+
+  RAJA::MultiReduceSum<REDUCE_POL2, int> bin_sums(M, 0);
+
+  RAJA::forall<EXEC_POL2>(array_range, [=](int i) {
+
+      bin_sums[array[i]] += 1;
+
+    });
+
+  bin_sums.get_all(bins);
+
+  printBins(bins, M);
+
 #endif
 //----------------------------------------------------------------------------//
 
@@ -36,8 +36,11 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/CacheInfo.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/first_touch.hpp"
+#include "RAJA/util/sizeclass_mempool.hpp"
 #include "RAJA/util/camp_aliases.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
@@ -97,6 +100,7 @@
 //
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
+#include "RAJA/pattern/forall_fused.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
 
@@ -115,6 +119,11 @@
 //
 #include "RAJA/util/ShmemTile.hpp"
 
+//
+// Per-thread scratch memory for loop bodies
+//
+#include "RAJA/util/ScratchArena.hpp"
+
 //
 // Atomic operations support
 //
@@ -131,6 +140,7 @@
 // Reduction objects
 //
 #include "RAJA/pattern/reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
 
 
 //
@@ -161,4 +171,8 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/compact.hpp"
+
+#include "RAJA/pattern/sort.hpp"
+
 #endif  // closing endif for header file include guard
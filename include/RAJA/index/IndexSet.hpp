@@ -28,11 +28,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
+#include "RAJA/internal/SegmentPartition.hpp"
 
 #include "RAJA/policy/PolicyBase.hpp"
 
@@ -190,7 +194,7 @@ public:
   {
     if (getSegmentTypes()[segid] == T0_TypeId) {
       Index_type offset = getSegmentOffsets()[segid];
-      return *reinterpret_cast<P0 const *>(data[offset]);
+      return *reinterpret_cast<P0 *>(data[offset]);
     }
     return PARENT::template getSegment<P0>(segid);
   }
@@ -297,18 +301,24 @@ public:
     push_internal(val, PUSH_FRONT, PUSH_NOCOPY);
   }
 
-  //! Add copy of segment to back end of index set.
+  //! Add copy of segment to back end of index set; an rvalue segment is
+  //! moved in.
   template <typename Tnew>
-  RAJA_INLINE void push_back(Tnew const &val)
+  RAJA_INLINE void push_back(Tnew &&val)
   {
-    push_internal(new Tnew(val), PUSH_BACK, PUSH_COPY);
+    push_internal(new camp::decay<Tnew>(std::forward<Tnew>(val)),
+                  PUSH_BACK,
+                  PUSH_COPY);
   }
 
-  //! Add copy of segment to front end of index set.
+  //! Add copy of segment to front end of index set; an rvalue segment is
+  //! moved in.
   template <typename Tnew>
-  RAJA_INLINE void push_front(Tnew const &val)
+  RAJA_INLINE void push_front(Tnew &&val)
   {
-    push_internal(new Tnew(val), PUSH_FRONT, PUSH_COPY);
+    push_internal(new camp::decay<Tnew>(std::forward<Tnew>(val)),
+                  PUSH_FRONT,
+                  PUSH_COPY);
   }
 
   //! Return total length -- sum of lengths of all segments
@@ -372,6 +382,9 @@ protected:
     data.push_back(val);
     owner.push_back(pcopy == PUSH_COPY);
 
+    // the partition no longer covers all segments
+    getSegmentPartitionPtr().reset();
+
     // Determine if we push at the front or back of the segment list
     if (pend == PUSH_BACK) {
       // Store the segment type
@@ -391,6 +404,11 @@ protected:
       // Store the segment offset in data[]
       getSegmentOffsets().push_front(data.size() - 1);
 
+      // Keep segment costs with their segments
+      if (!getSegmentCosts().empty()) {
+        getSegmentCosts().push_front(-1.0);
+      }
+
       // Store the segment icount
       getSegmentIcounts().push_front(0);
       size_t icount = val->size();
@@ -404,6 +422,12 @@ protected:
   //! Returns the number of indices (the total icount of segments
   RAJA_INLINE Index_type &getTotalLength() { return PARENT::getTotalLength(); }
 
+  //! Returns the number of indices (the total icount of segments
+  RAJA_INLINE Index_type getTotalLength() const
+  {
+    return PARENT::getTotalLength();
+  }
+
   //! set total length of the indexset
   RAJA_INLINE void setTotalLength(int n) { return PARENT::setTotalLength(n); }
 
@@ -491,10 +515,20 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
 
+  //! number of segment intervals that have been set
+  size_t getNumSegmentIntervals() const
+  {
+    return m_seg_interval_begin.size();
+  }
+
   //! get lower bound of segment identified with interval_id
   int getSegmentIntervalBegin(size_t interval_id) const
   {
@@ -507,6 +541,108 @@ public:
     return m_seg_interval_end[interval_id];
   }
 
+  //!  @name TypedIndexSet dependency graph methods
+  ///
+  /// A dependency graph orders segment execution for the omp_taskgraph_segit
+  /// iteration policy: node i belongs to segment i. With
+  /// omp_taskgraph_interval_segit, node i instead belongs to the segments of
+  /// interval i set with setSegmentInterval().
+  ///
+  /// Typical use is to call initDependencyGraph() once all segments have
+  /// been added, add edges with getDependencyGraph().addDependency(), and
+  /// then call finalizeDependencyGraph(). The graph is shared by copies and
+  /// can be executed any number of times.
+  ///
+
+  //! Allocate a dependency graph with one node per segment
+  void initDependencyGraph()
+  {
+    initDependencyGraph(static_cast<int>(getNumSegments()));
+  }
+
+  //! Allocate a dependency graph with the given number of nodes
+  void initDependencyGraph(int num_nodes)
+  {
+    getDepGraphPtr() = std::make_shared<DepGraph>(num_nodes);
+  }
+
+  //! Derive node semaphores from the graph edges and ready it for execution
+  void finalizeDependencyGraph() { getDepGraphPtr()->finalize(); }
+
+  //! Returns true if a dependency graph has been allocated
+  bool dependencyGraphSet() const { return getDepGraphPtr() != nullptr; }
+
+  //! Returns the dependency graph; requires dependencyGraphSet()
+  DepGraph &getDependencyGraph() const { return *getDepGraphPtr(); }
+
+  //! Returns the dependency graph node of the given segment or interval
+  DepGraphNode *getDepGraphNode(int id) const
+  {
+    return &(*getDepGraphPtr())[id];
+  }
+
+  //!  @name TypedIndexSet load balancing methods
+  ///
+  /// The omp_balanced_segit iteration policy executes a partition of the
+  /// segments into parts of about equal cost, one per thread. A segment
+  /// costs its length unless a cost has been set with setSegmentCost().
+  ///
+  /// The partition is built by the first loop that needs it and kept for
+  /// later loops until a segment is added or a cost changes. Copies share
+  /// it.
+  ///
+
+  //! Set the cost of executing the given segment, in any unit proportional
+  //! to time; a negative cost reverts to the segment length
+  void setSegmentCost(size_t segid, double cost)
+  {
+    RAJA::RAJAVec<double> &costs = getSegmentCosts();
+    if (segid >= costs.size()) {
+      costs.resize(segid + 1, -1.0);
+    }
+    costs[segid] = cost;
+    getSegmentPartitionPtr().reset();
+  }
+
+  //! Returns the cost of the given segment
+  double getSegmentCost(size_t segid) const
+  {
+    RAJA::RAJAVec<double> const &costs = getSegmentCosts();
+    if (segid < costs.size() && costs[segid] >= 0.0) {
+      return costs[segid];
+    }
+    return static_cast<double>(
+        (segid + 1 < getNumSegments() ? getSegmentIcounts()[segid + 1]
+                                      : getTotalLength())
+        - getSegmentIcounts()[segid]);
+  }
+
+  ///
+  /// Returns the partition of the segments into num_parts parts, building
+  /// it unless the last one built has that many parts.
+  ///
+  /// Loops may call this concurrently on the same index set; each one keeps
+  /// the partition it got alive while another replaces the cached one.
+  ///
+  std::shared_ptr<const SegmentPartition> getSegmentPartition(
+      int num_parts) const
+  {
+    std::shared_ptr<const SegmentPartition> &cache = getSegmentPartitionPtr();
+    std::shared_ptr<const SegmentPartition> partition =
+        std::atomic_load(&cache);
+    if (!partition || partition->getNumParts() != num_parts) {
+      partition = std::make_shared<const SegmentPartition>(
+          getSegmentIcounts().data(),
+          static_cast<int>(getNumSegments()),
+          getTotalLength(),
+          getSegmentCosts().data(),
+          static_cast<int>(getSegmentCosts().size()),
+          num_parts);
+      std::atomic_store(&cache, partition);
+    }
+    return partition;
+  }
+
 protected:
   //! Returns the mapping of  segment_index -> segment_type
   RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
@@ -544,6 +680,37 @@ protected:
     return PARENT::getSegmentIcounts();
   }
 
+  //! Returns the shared dependency graph, if any
+  RAJA_INLINE std::shared_ptr<DepGraph> &getDepGraphPtr()
+  {
+    return PARENT::getDepGraphPtr();
+  }
+
+  //! Returns the shared dependency graph, if any
+  RAJA_INLINE std::shared_ptr<DepGraph> const &getDepGraphPtr() const
+  {
+    return PARENT::getDepGraphPtr();
+  }
+
+  //! Returns the costs set for segments
+  RAJA_INLINE RAJA::RAJAVec<double> &getSegmentCosts()
+  {
+    return PARENT::getSegmentCosts();
+  }
+
+  //! Returns the costs set for segments
+  RAJA_INLINE RAJA::RAJAVec<double> const &getSegmentCosts() const
+  {
+    return PARENT::getSegmentCosts();
+  }
+
+  //! Returns the cached segment partition, if any
+  RAJA_INLINE std::shared_ptr<const SegmentPartition> &getSegmentPartitionPtr()
+      const
+  {
+    return PARENT::getSegmentPartitionPtr();
+  }
+
 public:
   ///
   /// Equality operator returns true if all segments are equal; else false.
@@ -608,6 +775,9 @@ public:
     segment_types = c.segment_types;
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
+    segment_costs = c.segment_costs;
+    m_dep_graph = c.m_dep_graph;
+    m_partition = std::atomic_load(&c.m_partition);
     m_len = c.m_len;
   }
 
@@ -618,6 +788,9 @@ public:
     swap(segment_types, other.segment_types);
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
+    swap(segment_costs, other.segment_costs);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_partition, other.m_partition);
     swap(m_len, other.m_len);
   }
 
@@ -670,8 +843,36 @@ protected:
     return segment_icounts;
   }
 
+  RAJA_INLINE std::shared_ptr<DepGraph> &getDepGraphPtr()
+  {
+    return m_dep_graph;
+  }
+
+  RAJA_INLINE std::shared_ptr<DepGraph> const &getDepGraphPtr() const
+  {
+    return m_dep_graph;
+  }
+
+  RAJA_INLINE RAJA::RAJAVec<double> &getSegmentCosts()
+  {
+    return segment_costs;
+  }
+
+  RAJA_INLINE RAJA::RAJAVec<double> const &getSegmentCosts() const
+  {
+    return segment_costs;
+  }
+
+  RAJA_INLINE std::shared_ptr<const SegmentPartition> &getSegmentPartitionPtr()
+      const
+  {
+    return m_partition;
+  }
+
   RAJA_INLINE Index_type &getTotalLength() { return m_len; }
 
+  RAJA_INLINE Index_type getTotalLength() const { return m_len; }
+
   RAJA_INLINE void setTotalLength(int n) { m_len = n; }
 
   RAJA_INLINE void increaseTotalLength(int n) { m_len += n; }
@@ -752,6 +953,16 @@ private:
   //! the icount of each segment
   RAJA::RAJAVec<Index_type> segment_icounts;
 
+  //! costs set for segments; negative for segments without one
+  RAJA::RAJAVec<double> segment_costs;
+
+  //! segment dependency graph, shared by copies
+  std::shared_ptr<DepGraph> m_dep_graph;
+
+  //! partition of the segments built for omp_balanced_segit, shared by
+  //! copies
+  mutable std::shared_ptr<const SegmentPartition> m_partition;
+
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
 };
@@ -42,9 +42,39 @@ namespace RAJA
  *        array of indices with given length.
  *
  *        Specifically, Range segments will be greater than RANGE_MIN_LENGTH
- *        and starting index and length of each range segment will be
- *        multiples of RANGE_ALIGN. These constants are defined in the
- *        RAJA config.hpp header file.
+ *        and starting index of each range segment will be a multiple of
+ *        RANGE_ALIGN. These constants are defined in the RAJA config.hpp
+ *        header file.
+ *
+ *        This is the original serial builder; buildTypedIndexSetAligned
+ *        is preferred.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& hiset,
+    const Index_type* const indices_in,
+    Index_type length);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Initialize index set with aligned Range, RangeStride and List
+ *        segments from array of indices with given length.
+ *
+ *        Each run of consecutive indices is trimmed to begin and end at
+ *        multiples of range_align; if at least range_min_length indices
+ *        remain they form a Range segment. Among the other indices, runs
+ *        with a constant stride other than 0 and 1 of at least
+ *        stride_min_length indices form RangeStride segments (pass 0 to
+ *        only build Range and List segments). The remaining indices form
+ *        List segments. Segments are in the order of the input array.
+ *
+ *        Chunks of the input are classified in parallel with OpenMP, when
+ *        enabled. The index set built does not depend on the number of
+ *        threads.
  *
  *        Routine does no error-checking on argements and assumes Index_type
  *        array contains valid indices.
@@ -53,9 +83,15 @@ namespace RAJA
  *
  ******************************************************************************
  */
-void buildTypedIndexSetAligned(IndexSet& hiset,
-                               const Index_type* const indices_in,
-                               Index_type length);
+void buildTypedIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    const Index_type* const indices_in,
+    Index_type length,
+    Index_type range_min_length = RANGE_MIN_LENGTH,
+    Index_type range_align = RANGE_ALIGN,
+    Index_type stride_min_length = RANGE_MIN_LENGTH);
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -76,7 +112,19 @@ void buildTypedIndexSetAligned(IndexSet& hiset,
  * Initialize lock-free "block" index set (planar division).
  *
  * The method chunks a fastDim x midDim x slowDim mesh into blocks that can
- * be dependency-scheduled, removing need for lock constructs.
+ * be dependency-scheduled, removing need for lock constructs. Pass zero for
+ * slowDim (and midDim) to block a 2d (1d) mesh.
+ *
+ * The slowest dimension is cut into one slab per OpenMP thread and each
+ * slab into two segments of whole planes. The index set dependency graph
+ * is set so that no two segments sharing a boundary plane run at the same
+ * time; execute the index set with the omp_taskgraph_segit segment
+ * iteration policy. Updates of a zone may touch the zones of neighboring
+ * planes (rows in 2d, entries in 1d).
+ *
+ * Order dependent updates, e.g. Gauss-Seidel sweeps, give the same result
+ * as running the segments in order with seq_segit: the first half of every
+ * slab, then the second half. This differs from lexical zone order.
  *
  * Note: Method assumes TypedIndexSet reference refers to an empty index set.
  *
@@ -86,9 +134,9 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
                         RAJA::RangeStrideSegment>& iset,
-    int fastDim,
-    int midDim,
-    int slowDim);
+    Index_type fastDim,
+    Index_type midDim,
+    Index_type slowDim);
 
 /*
  ******************************************************************************
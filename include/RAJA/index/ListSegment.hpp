@@ -28,13 +28,19 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstring>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/Span.hpp"
 
+#include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/first_touch.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -58,6 +64,14 @@ namespace RAJA
  *               expression using m_indx[i] as array index.
  *            }
  *
+ *         An Owned segment holds its indices in reference-counted storage.
+ *         Copies of it, e.g. when it is pushed into a TypedIndexSet, share
+ *         the storage, which is freed with the last copy. An Unowned segment
+ *         is a view of indices owned by the caller. Constructing a segment
+ *         from an array or a container deep copies the indices; to get a
+ *         private copy of a segment's indices, construct a new segment from
+ *         its begin() and size().
+ *
  ******************************************************************************
  */
 template <typename T>
@@ -82,58 +96,102 @@ class TypedListSegment
   //! alias for CPU memory tag
   using CPU_memory = std::integral_constant<bool, false>;
 
-  //! specialization for deallocation of GPU_memory
-  void deallocate(GPU_memory) { cudaErrchk(cudaFree(m_data)); }
+  //! storage shared by the copies of an owning segment
+  using storage_type = std::shared_ptr<T>;
 
   //! specialization for allocation of GPU_memory
-  void allocate(GPU_memory)
+  static storage_type allocate(Index_type size, GPU_memory)
   {
-    cudaErrchk(cudaMallocManaged((void**)&m_data,
-                                 m_size * sizeof(value_type),
+    T* ptr = nullptr;
+    cudaErrchk(cudaMallocManaged((void**)&ptr,
+                                 size * sizeof(T),
                                  cudaMemAttachGlobal));
+    return storage_type(ptr, [](T* p) { cudaErrchk(cudaFree(p)); });
   }
 
-  //! specialization for deallocation of CPU_memory
-  void deallocate(CPU_memory) { delete[] m_data; }
-
-  //! specialization for allocation of CPU_memory
-  void allocate(CPU_memory) { m_data = new T[m_size]; }
+  //! specialization for allocation of CPU_memory; pages are left untouched
+  //! so that the copy places them
+  static storage_type allocate(Index_type size, CPU_memory)
+  {
+    T* ptr = static_cast<T*>(
+        allocate_aligned(detail::first_touch_page_size, size * sizeof(T)));
+    if (ptr == nullptr) throw std::bad_alloc();
+    return storage_type(ptr, [](T* p) { free_aligned(p); });
+  }
 
 #if defined(RAJA_ENABLE_CUDA)
-  //! copy data from container using BlockCopy
-  template <typename Container>
-  void copy(Container&& src, BlockCopy)
+  //! copy data from contiguous memory of the same type to GPU_memory
+  void copy(T const* src, BlockCopy, GPU_memory)
   {
-    cudaErrchk(cudaMemcpy(
-        m_data, &(*src.begin()), m_size * sizeof(T), cudaMemcpyDefault));
+    cudaErrchk(cudaMemcpy(m_data, src, m_size * sizeof(T), cudaMemcpyDefault));
   }
 #endif
 
-  //! copy data from container using TrivialCopy
-  template <typename Container>
-  void copy(Container&& source, TrivialCopy)
+  //! copy data from contiguous memory of the same type to CPU_memory, in
+  //! parallel blocks that first touch pages by the threads omp_for_stable<>
+  //! would assign the indices to
+  void copy(T const* src, BlockCopy, CPU_memory)
   {
-    auto dest = m_data;
-    auto src = source.begin();
-    auto const end = source.end();
-    while (src != end) {
-      *dest = *src;
-      ++dest;
-      ++src;
+    T* dest = m_data;
+    detail::first_touch_blocks(m_size,
+                               Index_type(0),
+                               m_size * sizeof(T),
+                               [=](Index_type b, Index_type e) {
+                                 std::memcpy(dest + b,
+                                             src + b,
+                                             (e - b) * sizeof(T));
+                               });
+  }
+
+  //! copy data from a random access iterator using TrivialCopy, in the
+  //! same blocks as BlockCopy
+  template <typename Iter, typename Memory>
+  void copy(Iter src, TrivialCopy, Memory, std::random_access_iterator_tag)
+  {
+    T* dest = m_data;
+    detail::first_touch_blocks(m_size,
+                               Index_type(0),
+                               m_size * sizeof(T),
+                               [=](Index_type b, Index_type e) {
+                                 for (Index_type i = b; i < e; ++i) {
+                                   dest[i] = src[i];
+                                 }
+                               });
+  }
+
+  //! copy data from other iterators using TrivialCopy
+  template <typename Iter, typename Memory, typename Category>
+  void copy(Iter src, TrivialCopy, Memory, Category)
+  {
+    for (Index_type i = 0; i < m_size; ++i, ++src) {
+      m_data[i] = *src;
     }
   }
 
+  template <typename Iter, typename Memory>
+  void copy(Iter src, TrivialCopy, Memory mem)
+  {
+    copy(src,
+         TrivialCopy(),
+         mem,
+         typename std::iterator_traits<Iter>::iterator_category());
+  }
+
   // internal helper to allocate data and populate with data from a container
   template <bool GPU, typename Container>
   void allocate_and_copy(Container&& src)
   {
-    allocate(std::integral_constant<bool, GPU>());
-    static constexpr bool use_cuda =
-        GPU && std::is_pointer<decltype(src.begin())>::value &&
-        std::is_same<type_traits::IterableValue<Container>, value_type>::value;
+    using memory = std::integral_constant<bool, GPU>;
+    m_storage = allocate(m_size, memory());
+    m_data = m_storage.get();
+    using iter = camp::decay<decltype(src.begin())>;
+    static constexpr bool use_block =
+        std::is_pointer<iter>::value
+        && std::is_same<type_traits::IterableValue<Container>,
+                        value_type>::value;
     using TagType =
-        typename std::conditional<use_cuda, BlockCopy, TrivialCopy>::type;
-    copy(src, TagType());
+        typename std::conditional<use_block, BlockCopy, TrivialCopy>::type;
+    copy(src.begin(), TagType(), memory());
   }
 
 public:
@@ -165,6 +223,30 @@ public:
     initIndexData(values, length, owned);
   }
 
+  ///
+  /// \brief Construct list segment with a deep copy of the given array,
+  ///        allocated from a basic_mempool.
+  ///
+  /// The pool must outlive the segment and its copies. Indices are read on
+  /// the device only if the pool's allocator returns memory the device can
+  /// access.
+  ///
+  template <typename allocator_t>
+  TypedListSegment(const value_type* values,
+                   Index_type length,
+                   basic_mempool::MemPool<allocator_t>& pool)
+      : m_data(nullptr), m_size(0), m_owned(Unowned)
+  {
+    if (length <= 0 || values == nullptr) return;
+    T* ptr = pool.template malloc<T>(length);
+    if (ptr == nullptr) throw std::bad_alloc();
+    m_storage = storage_type(ptr, [&pool](T* p) { pool.free(p); });
+    m_data = ptr;
+    m_size = length;
+    m_owned = Owned;
+    copy(values, BlockCopy(), CPU_memory());
+  }
+
   ///
   /// Construct list segment from arbitrary object holding
   /// indices using a deep copy of given data.
@@ -181,42 +263,44 @@ public:
   }
 
   ///
-  /// Copy-constructor for list segment.
+  /// Copy-constructor for list segment; an owning copy shares the indices.
   ///
   TypedListSegment(const TypedListSegment& other)
+      : m_data(other.m_data),
+        m_size(other.m_size),
+        m_owned(other.m_owned),
+        m_storage(other.m_storage)
   {
-    // future TODO: switch to member initialization list ... somehow
-    initIndexData(other.m_data, other.m_size, other.m_owned);
   }
 
   ///
   /// Move-constructor for list segment.
   ///
   TypedListSegment(TypedListSegment&& rhs)
-      : m_data(rhs.m_data), m_size(rhs.m_size), m_owned(rhs.m_owned)
+      : m_data(rhs.m_data),
+        m_size(rhs.m_size),
+        m_owned(rhs.m_owned),
+        m_storage(std::move(rhs.m_storage))
   {
     // make the rhs non-owning so it's destructor won't have any side effects
     rhs.m_owned = Unowned;
   }
 
   ///
-  /// Destroy segment including its contents
+  /// Destroy segment; owned indices are freed with the last copy
   ///
-  ~TypedListSegment()
-  {
-    if (m_data == nullptr || m_owned != Owned) return;
-    deallocate(std::integral_constant<bool, Has_CUDA>());
-  }
+  ~TypedListSegment() = default;
 
 
   ///
   /// Swap function for copy-and-swap idiom.
   ///
-  RAJA_HOST_DEVICE void swap(TypedListSegment& other)
+  void swap(TypedListSegment& other)
   {
     camp::safe_swap(m_data, other.m_data);
     camp::safe_swap(m_size, other.m_size);
     camp::safe_swap(m_owned, other.m_owned);
+    m_storage.swap(other.m_storage);
   }
 
   //! accessor to get the end iterator for a TypedListSegment
@@ -227,6 +311,20 @@ public:
   //! accessor to retrieve the total number of elements in a TypedListSegment
   RAJA_HOST_DEVICE Index_type size() const { return m_size; }
 
+  //! Create a slice of this instance as a new instance
+  /*!
+   * \return A new instance holding elements begin to begin + length of this
+   * one; an owning slice shares the indices
+   */
+  TypedListSegment slice(Index_type begin, Index_type length) const
+  {
+    TypedListSegment s(*this);
+    begin = begin < m_size ? begin : m_size;
+    s.m_data = m_data + begin;
+    s.m_size = begin + length > m_size ? m_size - begin : length;
+    return s;
+  }
+
   //! get ownership of the data (Owned/Unowned)
   RAJA_HOST_DEVICE IndexOwnership getIndexOwnership() const { return m_owned; }
 
@@ -292,6 +390,8 @@ private:
   Index_type m_size;
   //! ownership flag to guide data copying/management
   IndexOwnership m_owned;
+  //! owner of the buffer, shared with copies; empty if not owned
+  storage_type m_storage;
 };
 
 //! alias for A TypedListSegment with storage type @Index_type
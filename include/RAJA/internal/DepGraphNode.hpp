@@ -32,7 +32,10 @@
 #include <atomic>
 #include <cstdlib>
 #include <iosfwd>
-#include <thread>
+#include <new>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/util/types.hpp"
 
@@ -45,28 +48,23 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         The semaphore counts the predecessors that have not completed
+ *         yet. The predecessor whose satisfyOne() call brings it to zero
+ *         is responsible for launching the node, so no thread ever waits
+ *         on a node that is not ready.
+ *
  ******************************************************************************
  */
-class RAJA_ALIGNED_ATTR(256) DepGraphNode
+class RAJA_ALIGNED_ATTR(CACHE_LINE_SIZE) DepGraphNode
 {
 public:
-  ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
-  ///
-  static const int _MaxDepTasks_ = 8;
-
   ///
   /// Default ctor initializes node to default state.
   ///
-  DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
-  {
-  }
+  DepGraphNode() : m_semaphore_reload_value(0), m_semaphore_value(0) {}
+
+  DepGraphNode(const DepGraphNode&) = delete;
+  DepGraphNode& operator=(const DepGraphNode&) = delete;
 
   ///
   /// Get/set semaphore value; i.e., the current number of (unsatisfied)
@@ -80,38 +78,31 @@ public:
   ///
   int& semaphoreReloadValue() { return m_semaphore_reload_value; }
 
-  ///
-  /// Ready this task to be used again
-  ///
-  void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
+  int semaphoreReloadValue() const { return m_semaphore_reload_value; }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Ready this task to be used again
   ///
-  void satisfyOne()
+  void reset()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
+    m_semaphore_value.store(m_semaphore_reload_value,
+                            std::memory_order_relaxed);
   }
 
   ///
-  /// Wait for all dependencies to be satisfied
+  /// Satisfy one incoming dependency. Returns true for the call that
+  /// satisfies the last one, i.e., when this task has become ready to run.
   ///
-  void wait()
+  bool satisfyOne()
   {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
-    }
+    return m_semaphore_value.fetch_sub(1, std::memory_order_acq_rel) == 1;
   }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
+  /// Get the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_task.size()); }
 
   ///
   /// Get/set the forward dependency task number associated with the given
@@ -120,18 +111,104 @@ public:
   ///
   int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
 
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
+
+  ///
+  /// Add a forward dependency; task cannot execute until this one completes.
+  ///
+  void addDepTask(int task) { m_dep_task.push_back(task); }
+
+  ///
+  /// Remove all forward dependencies of this task.
+  ///
+  void clearDepTasks() { m_dep_task.clear(); }
+
   ///
   /// Print task graph object node data to given output stream.
   ///
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
+  std::vector<int> m_dep_task;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
 };
 
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed-size set of dependency graph nodes, one per task.
+ *
+ *         Edges are added with addDependency(); finalize() derives the
+ *         semaphore reload value of every node from the edges and readies
+ *         the graph. Executors reset each node after it runs, so a
+ *         finalized graph can be executed any number of times; reset()
+ *         restores all nodes explicitly, e.g. after an interrupted run.
+ *
+ ******************************************************************************
+ */
+class DepGraph
+{
+public:
+  explicit DepGraph(int num_nodes)
+      : m_nodes(allocate_aligned_type<DepGraphNode>(
+            alignof(DepGraphNode), num_nodes * sizeof(DepGraphNode))),
+        m_size(num_nodes)
+  {
+    for (int i = 0; i < m_size; ++i) {
+      new (&m_nodes[i]) DepGraphNode();
+    }
+  }
+
+  DepGraph(const DepGraph&) = delete;
+  DepGraph& operator=(const DepGraph&) = delete;
+
+  ~DepGraph()
+  {
+    for (int i = 0; i < m_size; ++i) {
+      m_nodes[i].~DepGraphNode();
+    }
+    free_aligned(m_nodes);
+  }
+
+  //! number of nodes in the graph
+  int size() const { return m_size; }
+
+  DepGraphNode& operator[](int i) { return m_nodes[i]; }
+
+  const DepGraphNode& operator[](int i) const { return m_nodes[i]; }
+
+  //! task succ cannot execute until task pred completes
+  void addDependency(int pred, int succ) { m_nodes[pred].addDepTask(succ); }
+
+  ///
+  /// Set the reload value of every node to its number of predecessors,
+  /// record the nodes without predecessors, and reset all nodes.
+  ///
+  void finalize();
+
+  //! Ready all nodes to be executed again
+  void reset()
+  {
+    for (int i = 0; i < m_size; ++i) {
+      m_nodes[i].reset();
+    }
+  }
+
+  //! nodes without predecessors, valid after finalize()
+  const std::vector<int>& roots() const { return m_roots; }
+
+  ///
+  /// Print task graph to given output stream.
+  ///
+  void print(std::ostream& os) const;
+
+private:
+  DepGraphNode* m_nodes;
+  int m_size;
+  std::vector<int> m_roots;
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
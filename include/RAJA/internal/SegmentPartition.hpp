@@ -0,0 +1,109 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining a partition of index set segments
+ *          into parts of balanced cost.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SegmentPartition_HPP
+#define RAJA_SegmentPartition_HPP
+
+#include "RAJA/config.hpp"
+
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+///
+/// Iterations [begin, end) of the index set segment with id segment.
+///
+struct SegmentPiece {
+  int segment;
+  Index_type begin;
+  Index_type end;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Partition of the segments of an index set into a number of parts
+ *         of about equal cost, for the omp_balanced_segit policy.
+ *
+ *         The segments are laid end to end in order, each with a cost
+ *         spread evenly over its iterations, and the sequence is cut into
+ *         contiguous parts. Segments that straddle a cut are split into
+ *         pieces, and consecutive small segments end up in the same part.
+ *         Cuts are moved to a segment boundary rather than leave a piece
+ *         shorter than the minimum piece length.
+ *
+ ******************************************************************************
+ */
+class SegmentPartition
+{
+public:
+  ///
+  /// Partition segments whose iterations start at icounts[i] into
+  /// num_parts parts. Segment i costs costs[i], or its length if costs has
+  /// no entry for it or the entry is negative.
+  ///
+  SegmentPartition(const Index_type* icounts,
+                   int num_segments,
+                   Index_type total_length,
+                   const double* costs,
+                   int num_costs,
+                   int num_parts,
+                   Index_type min_piece = default_min_piece);
+
+  //! Default minimum length of a piece of a split segment
+  static constexpr Index_type default_min_piece = 256;
+
+  int getNumParts() const
+  {
+    return static_cast<int>(m_part_offsets.size()) - 1;
+  }
+
+  //! Get the pieces of a part, in index set order
+  const SegmentPiece* partBegin(int part) const
+  {
+    return m_pieces.data() + m_part_offsets[part];
+  }
+
+  const SegmentPiece* partEnd(int part) const
+  {
+    return m_pieces.data() + m_part_offsets[part + 1];
+  }
+
+  //! Sum of the costs of the pieces of a part
+  double getPartCost(int part) const { return m_part_costs[part]; }
+
+private:
+  std::vector<SegmentPiece> m_pieces;
+  std::vector<int> m_part_offsets;
+  std::vector<double> m_part_costs;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
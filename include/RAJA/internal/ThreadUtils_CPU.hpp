@@ -29,10 +29,14 @@
 
 #include "RAJA/config.hpp"
 
+#include <new>
+
 #if defined(RAJA_ENABLE_OPENMP)
 #include <omp.h>
 #endif
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 namespace RAJA
 {
 
@@ -55,6 +59,132 @@ int getMaxOMPThreadsCPU()
   return nthreads;
 }
 
+/*!
+*************************************************************************
+*
+* Return id of calling thread in the current OpenMP team.
+*
+*************************************************************************
+*/
+RAJA_INLINE
+int getCurrentOMPThreadCPU()
+{
+  int tid = 0;
+
+#if defined(RAJA_ENABLE_OPENMP)
+  tid = omp_get_thread_num();
+#endif
+
+  return tid;
+}
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Call f(begin, end) for each block of [0, n) that an OpenMP static
+ *         schedule assigns to thread tid of a team of nthreads threads.
+ *
+ *         chunk == 0 is schedule(static): one contiguous block per thread,
+ *         with the first n % nthreads threads taking one extra iteration.
+ *         chunk > 0 is schedule(static, chunk): chunks are dealt to threads
+ *         round-robin. The mapping depends only on n, chunk and nthreads.
+ *
+ ******************************************************************************
+ */
+template <typename Index, typename Func>
+RAJA_INLINE void forEachStaticBlock(Index n,
+                                    Index chunk,
+                                    int tid,
+                                    int nthreads,
+                                    Func&& f)
+{
+  if (chunk <= 0) {
+    const Index q = n / nthreads;
+    const Index r = n % nthreads;
+    const Index begin = q * tid + (tid < r ? tid : r);
+    const Index end = begin + q + (tid < r ? 1 : 0);
+    if (begin < end) f(begin, end);
+  } else {
+    const Index stride = chunk * nthreads;
+    for (Index begin = chunk * tid; begin < n; begin += stride) {
+      f(begin, (n - begin < chunk) ? n : begin + chunk);
+    }
+  }
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Value padded and aligned to occupy whole cache lines.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) CacheLinePadded {
+  T value;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed-size array holding one value per CPU thread.
+ *
+ *         Each value lives on its own cache line, so threads updating
+ *         their own slot never contend with (or falsely share a line with)
+ *         other threads.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ThreadSlots
+{
+  using slot_type = CacheLinePadded<T>;
+
+public:
+  ThreadSlots(int num_slots, T const& init)
+      : m_slots(allocate_aligned_type<slot_type>(
+            alignof(slot_type), num_slots * sizeof(slot_type))),
+        m_size(num_slots)
+  {
+    for (int i = 0; i < m_size; ++i) {
+      new (&m_slots[i]) slot_type{init};
+    }
+  }
+
+  ThreadSlots(const ThreadSlots&) = delete;
+  ThreadSlots& operator=(const ThreadSlots&) = delete;
+
+  ~ThreadSlots()
+  {
+    for (int i = 0; i < m_size; ++i) {
+      m_slots[i].~slot_type();
+    }
+    free_aligned(m_slots);
+  }
+
+  int size() const { return m_size; }
+
+  T& operator[](int i) { return m_slots[i].value; }
+
+  const T& operator[](int i) const { return m_slots[i].value; }
+
+  void fill(T const& val)
+  {
+    for (int i = 0; i < m_size; ++i) {
+      m_slots[i].value = val;
+    }
+  }
+
+private:
+  slot_type* m_slots;
+  int m_size;
+};
+
+}  // namespace detail
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
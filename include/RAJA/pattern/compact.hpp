@@ -0,0 +1,339 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA stream compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_HPP
+#define RAJA_compact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/concepts.hpp"
+#include "camp/helpers.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/pattern/scan.hpp"
+
+//
+// Each backend provides, in namespace RAJA::impl::compact,
+//
+//   Index select(policy, Index n, Keep keep, Emit emit)
+//     calls emit(i, pos) for every i in [0, n) with keep(i) true, where pos
+//     is the number of such i before it; returns the number kept.
+//
+//   Index partition(policy, Index n, Keep keep, Emit emit)
+//     calls emit(i, pos) for every i in [0, n); kept i get the positions
+//     [0, count) and the rest [count, n), both in order; returns count.
+//
+// Predicate evaluation, the running count and the scatter are fused, so no
+// flag or offset array of length n is ever formed.
+//
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <typename Iter>
+using IterDiff = typename std::iterator_traits<Iter>::difference_type;
+
+template <typename Container>
+using ContainerDiff = IterDiff<camp::iterator_from<Container>>;
+
+//! return type R when all Conds hold
+template <typename R, typename... Conds>
+using enable_if_return =
+    typename std::enable_if<concepts::all_of<Conds...>::value, R>::type;
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  stream compaction (copy_if) execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting elements to keep
+*
+* \return number of elements written to out; their relative order is kept
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+detail::enable_if_return<detail::IterDiff<Iter>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_iterator<Iter>,
+                         type_traits::is_iterator<IterOut>>
+compact(const ExecPolicy &p, Iter begin, Iter end, IterOut out, Predicate pred)
+{
+  using T = detail::IterVal<Iter>;
+  using Index = detail::IterDiff<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction returning bool");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (end - begin <= 0) return 0;
+  return impl::compact::select(
+      p,
+      Index(end - begin),
+      [=](Index i) -> bool { return pred(*(begin + i)); },
+      [=](Index i, Index pos) { *(out + pos) = *(begin + i); });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting elements for the first part
+*
+* \return number of elements satisfying pred; these are written to the front
+*of out followed by all others, each part keeping its relative order
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Predicate>
+detail::enable_if_return<detail::IterDiff<Iter>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_iterator<Iter>,
+                         type_traits::is_iterator<IterOut>>
+partition(const ExecPolicy &p,
+          Iter begin,
+          Iter end,
+          IterOut out,
+          Predicate pred)
+{
+  using T = detail::IterVal<Iter>;
+  using Index = detail::IterDiff<Iter>;
+  static_assert(type_traits::is_unary_function<Predicate, bool, T>::value,
+                "Predicate must model UnaryFunction returning bool");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (end - begin <= 0) return 0;
+  return impl::compact::partition(
+      p,
+      Index(end - begin),
+      [=](Index i) -> bool { return pred(*(begin + i)); },
+      [=](Index i, Index pos) { *(out + pos) = *(begin + i); });
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique (unique_copy) execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] begin Pointer or Random-Access Iterator to start of data range
+* \param[in] end Pointer or Random-Access Iterator to end of data range
+*(exclusive)
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] eq binary predicate comparing adjacent elements for equality
+*
+* \return number of elements written to out; only the first element of each
+*run of consecutive equal elements is kept
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename IterOut,
+          typename Compare = operators::equal_to<detail::IterVal<Iter>>>
+detail::enable_if_return<detail::IterDiff<Iter>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_iterator<Iter>,
+                         type_traits::is_iterator<IterOut>>
+unique(const ExecPolicy &p,
+       Iter begin,
+       Iter end,
+       IterOut out,
+       Compare eq = Compare{})
+{
+  using T = detail::IterVal<Iter>;
+  using Index = detail::IterDiff<Iter>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction returning bool");
+  static_assert(type_traits::is_random_access_iterator<Iter>::value,
+                "Iterator must model RandomAccessIterator");
+  static_assert(type_traits::is_random_access_iterator<IterOut>::value,
+                "Output Iterator must model RandomAccessIterator");
+  if (end - begin <= 0) return 0;
+  return impl::compact::select(
+      p,
+      Index(end - begin),
+      [=](Index i) -> bool {
+        return i == 0 || !eq(*(begin + (i - 1)), *(begin + i));
+      },
+      [=](Index i, Index pos) { *(out + pos) = *(begin + i); });
+}
+
+// =============================================================================
+
+/*!
+******************************************************************************
+*
+* \brief  stream compaction (copy_if) execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting elements to keep
+*
+* \return number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Predicate>
+detail::enable_if_return<detail::ContainerDiff<Container>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_range<Container>,
+                         type_traits::is_iterator<IterOut>>
+compact(const ExecPolicy &p, Container &c, IterOut out, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::compact(p, std::begin(c), std::end(c), out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  stable partition execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] pred unary predicate selecting elements for the first part
+*
+* \return number of elements satisfying pred
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Predicate>
+detail::enable_if_return<detail::ContainerDiff<Container>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_range<Container>,
+                         type_traits::is_iterator<IterOut>>
+partition(const ExecPolicy &p, Container &c, IterOut out, Predicate pred)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::partition(p, std::begin(c), std::end(c), out, pred);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  unique (unique_copy) execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] c Random-Access Container
+* \param[out] out Pointer or Random-Access Iterator to start of output data
+*range
+* \param[in] eq binary predicate comparing adjacent elements for equality
+*
+* \return number of elements written to out
+*
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename IterOut,
+          typename Compare =
+              operators::equal_to<detail::ContainerVal<Container>>>
+detail::enable_if_return<detail::ContainerDiff<Container>,
+                         type_traits::is_execution_policy<ExecPolicy>,
+                         type_traits::is_range<Container>,
+                         type_traits::is_iterator<IterOut>>
+unique(const ExecPolicy &p, Container &c, IterOut out, Compare eq = Compare{})
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+  return RAJA::unique(p, std::begin(c), std::end(c), out, eq);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto compact(Args &&... args)
+    -> decltype(RAJA::compact(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::compact(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto partition(Args &&... args)
+    -> decltype(RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::partition(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+template <typename ExecPolicy, typename... Args>
+auto unique(Args &&... args)
+    -> decltype(RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...))
+{
+  return RAJA::unique(ExecPolicy{}, std::forward<Args>(args)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
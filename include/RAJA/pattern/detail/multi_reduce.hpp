@@ -0,0 +1,408 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Base types used in common for RAJA multi-reducer objects.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_MULTI_REDUCE_HPP
+#define RAJA_PATTERN_DETAIL_MULTI_REDUCE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+
+#include "RAJA/util/mutex.hpp"
+
+#define RAJA_DECLARE_MULTI_REDUCER(OP, POL, THREADS)                       \
+  template <typename T>                                                    \
+  class MultiReduce##OP<POL, T>                                            \
+      : public reduce::detail::BaseMultiReduce##OP<T, THREADS>             \
+  {                                                                        \
+  public:                                                                  \
+    using Base = reduce::detail::BaseMultiReduce##OP<T, THREADS>;          \
+    using Base::Base;                                                      \
+  };
+
+#define RAJA_DECLARE_ALL_MULTI_REDUCERS(POL, THREADS) \
+  RAJA_DECLARE_MULTI_REDUCER(Sum, POL, THREADS)       \
+  RAJA_DECLARE_MULTI_REDUCER(Min, POL, THREADS)       \
+  RAJA_DECLARE_MULTI_REDUCER(Max, POL, THREADS)
+
+namespace RAJA
+{
+
+namespace reduce
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Privatized bins shared by a multi-reducer and all of its copies.
+ *
+ *         Storage holds one row of bins per thread reported by Threads; rows
+ *         are padded to whole cache lines so threads never share a line.
+ *         A copy made on a thread outside that range, or on a thread whose
+ *         id Threads reports as negative because it is not unique, keeps a
+ *         private row that is merged into a lock-guarded spill row when it
+ *         is destroyed.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce, typename Threads>
+class MultiReduceData
+{
+public:
+  MultiReduceData(size_t num_bins, T init_val, T identity_)
+      : m_num_bins(num_bins),
+        m_num_rows(Threads::max_threads()),
+        m_stride(stride_for(num_bins)),
+        m_data(allocate_aligned_type<T>(CACHE_LINE_SIZE,
+                                        m_num_rows * m_stride * sizeof(T))),
+        m_spill(num_bins, identity_),
+        m_init(init_val),
+        m_identity(identity_)
+  {
+    for (size_t i = 0; i < m_num_rows * m_stride; ++i) {
+      new (&m_data[i]) T(identity_);
+    }
+  }
+
+  MultiReduceData(const MultiReduceData&) = delete;
+  MultiReduceData& operator=(const MultiReduceData&) = delete;
+
+  ~MultiReduceData()
+  {
+    for (size_t i = 0; i < m_num_rows * m_stride; ++i) {
+      m_data[i].~T();
+    }
+    free_aligned(m_data);
+  }
+
+  size_t size() const { return m_num_bins; }
+
+  T identity() const { return m_identity; }
+
+  //! row owned by thread tid, or nullptr if tid has no row
+  T* row(int tid) const
+  {
+    return (tid >= 0 && static_cast<size_t>(tid) < m_num_rows)
+               ? m_data + tid * m_stride
+               : nullptr;
+  }
+
+  //! merge a private row into the spill row
+  void spill(const T* vals)
+  {
+    lock_guard<typename Threads::mutex_type> lock(m_spill_lock);
+    for (size_t b = 0; b < m_num_bins; ++b) {
+      Reduce{}(m_spill[b], vals[b]);
+    }
+  }
+
+  //! fold all rows of one bin, in thread order
+  T get(size_t bin) const
+  {
+    T res = m_init;
+    for (size_t r = 0; r < m_num_rows; ++r) {
+      Reduce{}(res, m_data[r * m_stride + bin]);
+    }
+    Reduce{}(res, m_spill[bin]);
+    return res;
+  }
+
+  //! fold all rows of every bin into out[0, size())
+  template <typename Container>
+  void get_all(Container& out) const
+  {
+    for (size_t b = 0; b < m_num_bins; ++b) {
+      out[b] = m_init;
+    }
+    for (size_t r = 0; r < m_num_rows; ++r) {
+      const T* vals = m_data + r * m_stride;
+      for (size_t b = 0; b < m_num_bins; ++b) {
+        Reduce{}(out[b], vals[b]);
+      }
+    }
+    for (size_t b = 0; b < m_num_bins; ++b) {
+      Reduce{}(out[b], m_spill[b]);
+    }
+  }
+
+private:
+  //! row length rounded up so each row starts on its own cache line
+  static size_t stride_for(size_t num_bins)
+  {
+    const size_t per_line =
+        sizeof(T) < CACHE_LINE_SIZE ? CACHE_LINE_SIZE / sizeof(T) : 1;
+    return ((num_bins + per_line - 1) / per_line) * per_line;
+  }
+
+  size_t m_num_bins;
+  size_t m_num_rows;
+  size_t m_stride;
+  T* m_data;
+  std::vector<T> m_spill;
+  typename Threads::mutex_type m_spill_lock;
+  T m_init;
+  T m_identity;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Base multi-reducer class template.
+ *
+ *         Each copy binds to the bin row of the thread that made it, which
+ *         matches how RAJA execution policies privatize loop bodies.
+ *
+ ******************************************************************************
+ */
+template <typename T, template <typename> class Reduce_, typename Threads>
+class BaseMultiReduce
+{
+  using Reduce = Reduce_<T>;
+  using Data = MultiReduceData<T, Reduce, Threads>;
+
+  std::shared_ptr<Data> m_data;
+  std::vector<T> m_own;
+  T* m_row = nullptr;
+
+  void bind()
+  {
+    m_row = m_data->row(Threads::thread_num());
+    if (!m_row) {
+      m_own.assign(m_data->size(), m_data->identity());
+      m_row = m_own.data();
+    }
+  }
+
+  void release()
+  {
+    if (!m_own.empty()) {
+      m_data->spill(m_own.data());
+      m_own.clear();
+    }
+  }
+
+public:
+  using value_type = T;
+  using reduce_type = Reduce;
+
+  //! prohibit compiler-generated default ctor
+  BaseMultiReduce() = delete;
+
+  explicit BaseMultiReduce(size_t num_bins,
+                           T init_val = Reduce::identity(),
+                           T identity_ = Reduce::identity())
+  {
+    reset(num_bins, init_val, identity_);
+  }
+
+  BaseMultiReduce(const BaseMultiReduce& copy) : m_data(copy.m_data)
+  {
+    bind();
+  }
+
+  //! prohibit compiler-generated copy assignment
+  BaseMultiReduce& operator=(const BaseMultiReduce&) = delete;
+
+  ~BaseMultiReduce() { release(); }
+
+  //! discard all bins and start over with num_bins bins
+  void reset(size_t num_bins,
+             T init_val = Reduce::identity(),
+             T identity_ = Reduce::identity())
+  {
+    if (m_data) {
+      release();
+    }
+    m_data = std::make_shared<Data>(num_bins, init_val, identity_);
+    bind();
+  }
+
+  //! number of bins
+  size_t size() const { return m_data->size(); }
+
+  //! reference to this thread's privatized copy of a bin
+  T& local(size_t bin) const { return m_row[bin]; }
+
+  //! Get the calculated reduced value of a single bin
+  T get(size_t bin) const { return m_data->get(bin); }
+
+  //! Write the calculated reduced values of all bins to out[0, size())
+  template <typename Container>
+  void get_all(Container& out) const
+  {
+    m_data->get_all(out);
+  }
+
+  //! Get the calculated reduced values of all bins
+  std::vector<T> get_all() const
+  {
+    std::vector<T> out(size());
+    m_data->get_all(out);
+    return out;
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reference to one bin of a multi-reducer; provides the reduction
+ *         operation of the owning reducer.
+ *
+ ******************************************************************************
+ */
+template <typename T, template <typename> class Reduce>
+class MultiReduceBinRef
+{
+protected:
+  T& m_val;
+
+public:
+  explicit MultiReduceBinRef(T& val) : m_val(val) {}
+
+  void combine(T const& rhs) const { Reduce<T>{}(m_val, rhs); }
+};
+
+template <typename T>
+class MultiReduceSumRef : public MultiReduceBinRef<T, RAJA::reduce::sum>
+{
+public:
+  using MultiReduceBinRef<T, RAJA::reduce::sum>::MultiReduceBinRef;
+
+  //! reducer function; updates the current bin's state
+  const MultiReduceSumRef& operator+=(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+template <typename T>
+class MultiReduceMinRef : public MultiReduceBinRef<T, RAJA::reduce::min>
+{
+public:
+  using MultiReduceBinRef<T, RAJA::reduce::min>::MultiReduceBinRef;
+
+  //! reducer function; updates the current bin's state
+  const MultiReduceMinRef& min(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+template <typename T>
+class MultiReduceMaxRef : public MultiReduceBinRef<T, RAJA::reduce::max>
+{
+public:
+  using MultiReduceBinRef<T, RAJA::reduce::max>::MultiReduceBinRef;
+
+  //! reducer function; updates the current bin's state
+  const MultiReduceMaxRef& max(T rhs) const
+  {
+    this->combine(rhs);
+    return *this;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Multi-bin sum reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Threads>
+class BaseMultiReduceSum
+    : public BaseMultiReduce<T, RAJA::reduce::sum, Threads>
+{
+public:
+  using Base = BaseMultiReduce<T, RAJA::reduce::sum, Threads>;
+  using Base::Base;
+
+  MultiReduceSumRef<T> operator[](size_t bin) const
+  {
+    return MultiReduceSumRef<T>(this->local(bin));
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Multi-bin min reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Threads>
+class BaseMultiReduceMin
+    : public BaseMultiReduce<T, RAJA::reduce::min, Threads>
+{
+public:
+  using Base = BaseMultiReduce<T, RAJA::reduce::min, Threads>;
+  using Base::Base;
+
+  MultiReduceMinRef<T> operator[](size_t bin) const
+  {
+    return MultiReduceMinRef<T>(this->local(bin));
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Multi-bin max reducer class template.
+ *
+ **************************************************************************
+ */
+template <typename T, typename Threads>
+class BaseMultiReduceMax
+    : public BaseMultiReduce<T, RAJA::reduce::max, Threads>
+{
+public:
+  using Base = BaseMultiReduce<T, RAJA::reduce::max, Threads>;
+  using Base::Base;
+
+  MultiReduceMaxRef<T> operator[](size_t bin) const
+  {
+    return MultiReduceMaxRef<T>(this->local(bin));
+  }
+};
+
+}  // namespace detail
+
+}  // namespace reduce
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_MULTI_REDUCE_HPP */
@@ -0,0 +1,488 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Parallel sort algorithms used in common by RAJA sort backends.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/Operators.hpp"
+
+//
+// The algorithms in this file are written against an executor type Par
+// supplied by each parallel backend:
+//
+//   static int Par::max_threads();
+//     number of threads that run(...) may use
+//
+//   template <typename Body> static void Par::run(int num_tasks, Body body);
+//     calls body(t) for every t in [0, num_tasks), possibly concurrently;
+//     tasks t and t + 1 are preferably handled by consecutive threads
+//
+
+namespace RAJA
+{
+
+namespace impl
+{
+
+namespace sort
+{
+
+namespace detail
+{
+
+//! ranges shorter than this are sorted serially
+const long sort_serial_cutoff = 1 << 14;
+
+//! bits of the key handled by one radix pass
+const int radix_bits = 8;
+const int radix_size = 1 << radix_bits;
+
+/*!
+ * \brief  Key and comparator combinations sorted with a radix sort:
+ *         integral keys ordered by less or greater.
+ */
+template <typename Key, typename Compare>
+struct is_radix_sortable
+    : std::integral_constant<
+          bool,
+          std::is_integral<Key>::value && !std::is_same<Key, bool>::value
+              && (std::is_same<Compare, operators::less<Key>>::value
+                  || std::is_same<Compare, std::less<Key>>::value
+                  || std::is_same<Compare, operators::greater<Key>>::value
+                  || std::is_same<Compare, std::greater<Key>>::value)> {
+};
+
+template <typename Key, typename Compare>
+struct is_radix_descending
+    : std::integral_constant<
+          bool,
+          std::is_same<Compare, operators::greater<Key>>::value
+              || std::is_same<Compare, std::greater<Key>>::value> {
+};
+
+//! first index of block t when [0, n) is split into p blocks
+template <typename Index>
+Index block_begin(Index n, int p, int t)
+{
+  return static_cast<Index>((static_cast<long double>(n) * t) / p);
+}
+
+/*!
+ * \brief  Map a key to an unsigned value whose natural order is the order
+ *         requested for the key.
+ */
+template <typename Key, bool Descending>
+typename std::make_unsigned<Key>::type radix_bits_of(Key k)
+{
+  using U = typename std::make_unsigned<Key>::type;
+  U u = static_cast<U>(k);
+  if (std::is_signed<Key>::value) {
+    u ^= U(1) << (sizeof(U) * CHAR_BIT - 1);
+  }
+  return Descending ? static_cast<U>(~u) : u;
+}
+
+/*!
+ * \brief  One stable counting pass of an LSD radix sort over the digit at
+ *         shift: keys (and values when HasValues) are moved from src to dst.
+ *
+ *         count holds the per-block digit histograms computed by the caller
+ *         and is turned into the scatter offset of each block in place.
+ */
+template <typename Par,
+          bool Descending,
+          bool HasValues,
+          typename Index,
+          typename SrcKey,
+          typename DstKey,
+          typename SrcVal,
+          typename DstVal>
+void radix_scatter(int p,
+                   Index n,
+                   int shift,
+                   std::vector<Index>& count,
+                   SrcKey src_key,
+                   DstKey dst_key,
+                   SrcVal src_val,
+                   DstVal dst_val)
+{
+  using Key = typename std::iterator_traits<SrcKey>::value_type;
+
+  // digit-major, block-minor exclusive scan keeps equal digits in order
+  Index offset = 0;
+  for (int d = 0; d < radix_size; ++d) {
+    for (int t = 0; t < p; ++t) {
+      Index c = count[t * radix_size + d];
+      count[t * radix_size + d] = offset;
+      offset += c;
+    }
+  }
+
+  Par::run(p, [=, &count](int t) {
+    Index* pos = &count[t * radix_size];
+    const Index i1 = block_begin(n, p, t + 1);
+    for (Index i = block_begin(n, p, t); i < i1; ++i) {
+      const Key k = *(src_key + i);
+      const int d = static_cast<int>(
+          (radix_bits_of<Key, Descending>(k) >> shift) & (radix_size - 1));
+      const Index o = pos[d]++;
+      *(dst_key + o) = k;
+      if (HasValues) {
+        *(dst_val + o) = std::move(*(src_val + i));
+      }
+    }
+  });
+}
+
+/*!
+ * \brief  Parallel LSD radix sort of [keys, keys + n); values, when
+ *         HasValues, are permuted along with their keys. The sort is stable.
+ *
+ *         Each pass histograms the digit per block, skips the pass when all
+ *         keys share that digit, and otherwise scatters between the input and
+ *         one scratch buffer.
+ */
+template <typename Par,
+          bool Descending,
+          bool HasValues,
+          typename KeyIter,
+          typename ValIter>
+void radix_sort(KeyIter keys, ValIter vals, long n)
+{
+  using Index = long;
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+
+  const int p = static_cast<int>(
+      std::max<Index>(1, std::min<Index>(Par::max_threads(), n / 4096)));
+
+  std::vector<Key> key_buf(n);
+  std::vector<Val> val_buf(HasValues ? n : 0);
+  std::vector<Index> count(p * radix_size);
+
+  // true while the current data lives in the scratch buffers
+  bool in_buf = false;
+
+  for (int shift = 0; shift < static_cast<int>(sizeof(Key) * CHAR_BIT);
+       shift += radix_bits) {
+    std::fill(count.begin(), count.end(), 0);
+    const Key* buf_key = key_buf.data();
+    Par::run(p, [=, &count](int t) {
+      Index* c = &count[t * radix_size];
+      const Index i1 = block_begin(n, p, t + 1);
+      for (Index i = block_begin(n, p, t); i < i1; ++i) {
+        const Key k = in_buf ? buf_key[i] : *(keys + i);
+        ++c[(radix_bits_of<Key, Descending>(k) >> shift) & (radix_size - 1)];
+      }
+    });
+
+    bool trivial = false;
+    for (int d = 0; d < radix_size && !trivial; ++d) {
+      Index total = 0;
+      for (int t = 0; t < p; ++t) {
+        total += count[t * radix_size + d];
+      }
+      trivial = (total == n);
+    }
+    if (trivial) continue;
+
+    if (in_buf) {
+      radix_scatter<Par, Descending, HasValues>(
+          p, n, shift, count, key_buf.data(), keys, val_buf.data(), vals);
+    } else {
+      radix_scatter<Par, Descending, HasValues>(
+          p, n, shift, count, keys, key_buf.data(), vals, val_buf.data());
+    }
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+    Key* buf_key = key_buf.data();
+    Val* buf_val = val_buf.data();
+    Par::run(p, [=](int t) {
+      const Index i1 = block_begin(n, p, t + 1);
+      for (Index i = block_begin(n, p, t); i < i1; ++i) {
+        *(keys + i) = buf_key[i];
+        if (HasValues) {
+          *(vals + i) = std::move(buf_val[i]);
+        }
+      }
+    });
+  }
+}
+
+/*!
+ * \brief  Number of elements of sorted [a, a + na) that precede output
+ *         position d when merged with sorted [b, b + nb) by std::merge.
+ */
+template <typename Iter, typename Index, typename Compare>
+Index merge_corank(Iter a, Index na, Iter b, Index nb, Index d, Compare comp)
+{
+  Index lo = std::max<Index>(0, d - nb);
+  Index hi = std::min<Index>(d, na);
+  while (lo < hi) {
+    const Index i = lo + (hi - lo) / 2;
+    const Index j = d - i;
+    // a[i] is merged before b[j - 1] unless b[j - 1] < a[i]
+    if (j > 0 && !comp(*(b + (j - 1)), *(a + i))) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief  One round of the merge sort: merge neighbouring sorted runs of
+ *         src, given by their start offsets, into dst. The output of every
+ *         merge is split by merge_corank into pieces of about piece
+ *         elements, and all pieces are merged in parallel.
+ */
+template <typename Par, typename Src, typename Dst, typename Compare>
+void merge_round(Src src,
+                 Dst dst,
+                 const std::vector<long>& runs,
+                 long piece,
+                 Compare comp)
+{
+  struct Task {
+    long run;
+    long d0, d1;
+  };
+
+  const long num_runs = static_cast<long>(runs.size()) - 1;
+  std::vector<Task> tasks;
+  for (long r = 0; r < num_runs; r += 2) {
+    const long len = runs[std::min(r + 2, num_runs)] - runs[r];
+    for (long d = 0; d < len; d += piece) {
+      tasks.push_back(Task{r, d, std::min(len, d + piece)});
+    }
+  }
+
+  const Task* task = tasks.data();
+  const long* run = runs.data();
+  Par::run(static_cast<int>(tasks.size()), [=](int k) {
+    const Task& tk = task[k];
+    const long a0 = run[tk.run];
+    if (tk.run + 1 == num_runs) {
+      // odd run out is carried over unchanged
+      std::move(src + (a0 + tk.d0), src + (a0 + tk.d1), dst + (a0 + tk.d0));
+      return;
+    }
+    const long b0 = run[tk.run + 1];
+    const long na = b0 - a0;
+    const long nb = run[tk.run + 2] - b0;
+    const long i0 = merge_corank(src + a0, na, src + b0, nb, tk.d0, comp);
+    const long i1 = merge_corank(src + a0, na, src + b0, nb, tk.d1, comp);
+    std::merge(std::make_move_iterator(src + (a0 + i0)),
+               std::make_move_iterator(src + (a0 + i1)),
+               std::make_move_iterator(src + (b0 + tk.d0 - i0)),
+               std::make_move_iterator(src + (b0 + tk.d1 - i1)),
+               dst + (a0 + tk.d0),
+               comp);
+  });
+}
+
+/*!
+ * \brief  Parallel merge sort of [begin, end): blocks are sorted in
+ *         parallel with std::sort (std::stable_sort when Stable) and then
+ *         merged pairwise with merges that are themselves parallel.
+ */
+template <typename Par, bool Stable, typename Iter, typename Compare>
+void merge_sort(Iter begin, Iter end, Compare comp)
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+  const long n = end - begin;
+  const int p = static_cast<int>(std::max<long>(
+      1, std::min<long>(Par::max_threads(), n / sort_serial_cutoff)));
+
+  if (p == 1) {
+    if (Stable) {
+      std::stable_sort(begin, end, comp);
+    } else {
+      std::sort(begin, end, comp);
+    }
+    return;
+  }
+
+  std::vector<long> runs(p + 1);
+  for (int t = 0; t <= p; ++t) {
+    runs[t] = block_begin(n, p, t);
+  }
+
+  const long* run = runs.data();
+  Par::run(p, [=](int t) {
+    if (Stable) {
+      std::stable_sort(begin + run[t], begin + run[t + 1], comp);
+    } else {
+      std::sort(begin + run[t], begin + run[t + 1], comp);
+    }
+  });
+
+  std::vector<T> buf(n);
+  const long piece = (n + p - 1) / p;
+  bool in_buf = false;
+  while (runs.size() > 2) {
+    if (in_buf) {
+      merge_round<Par>(buf.data(), begin, runs, piece, comp);
+    } else {
+      merge_round<Par>(begin, buf.data(), runs, piece, comp);
+    }
+    in_buf = !in_buf;
+
+    std::vector<long> merged;
+    for (size_t r = 0; r < runs.size() - 1; r += 2) {
+      merged.push_back(runs[r]);
+    }
+    merged.push_back(n);
+    runs.swap(merged);
+  }
+
+  if (in_buf) {
+    T* src = buf.data();
+    Par::run(p, [=](int t) {
+      const long i0 = block_begin(n, p, t);
+      const long i1 = block_begin(n, p, t + 1);
+      std::move(src + i0, src + i1, begin + i0);
+    });
+  }
+}
+
+//! order pairs by their first member only
+template <typename Pair, typename Compare>
+struct compare_first {
+  Compare comp;
+  bool operator()(const Pair& a, const Pair& b) const
+  {
+    return comp(a.first, b.first);
+  }
+};
+
+/*!
+ * \brief  Sort [keys, keys + n) with the given executor, choosing radix sort
+ *         for integral keys ordered by less or greater and merge sort
+ *         otherwise.
+ */
+template <typename Par, bool Stable, typename KeyIter, typename Compare>
+typename std::enable_if<
+    is_radix_sortable<typename std::iterator_traits<KeyIter>::value_type,
+                      Compare>::value>::type
+sort(KeyIter begin, KeyIter end, Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  const long n = end - begin;
+  if (n < sort_serial_cutoff) {
+    std::sort(begin, end, comp);
+    return;
+  }
+  radix_sort<Par, is_radix_descending<Key, Compare>::value, false>(
+      begin, static_cast<Key*>(nullptr), n);
+}
+
+template <typename Par, bool Stable, typename KeyIter, typename Compare>
+typename std::enable_if<
+    !is_radix_sortable<typename std::iterator_traits<KeyIter>::value_type,
+                       Compare>::value>::type
+sort(KeyIter begin, KeyIter end, Compare comp)
+{
+  merge_sort<Par, Stable>(begin, end, comp);
+}
+
+/*!
+ * \brief  Sort [keys, keys + n) and permute vals along with them, with the
+ *         same choice of algorithm as sort.
+ */
+template <typename Par,
+          bool Stable,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+typename std::enable_if<
+    is_radix_sortable<typename std::iterator_traits<KeyIter>::value_type,
+                      Compare>::value>::type
+sort_pairs(KeyIter keys_begin, KeyIter keys_end, ValIter vals, Compare)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  radix_sort<Par, is_radix_descending<Key, Compare>::value, true>(
+      keys_begin, vals, keys_end - keys_begin);
+}
+
+template <typename Par,
+          bool Stable,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+typename std::enable_if<
+    !is_radix_sortable<typename std::iterator_traits<KeyIter>::value_type,
+                       Compare>::value>::type
+sort_pairs(KeyIter keys_begin, KeyIter keys_end, ValIter vals, Compare comp)
+{
+  using Key = typename std::iterator_traits<KeyIter>::value_type;
+  using Val = typename std::iterator_traits<ValIter>::value_type;
+  using Pair = std::pair<Key, Val>;
+  const long n = keys_end - keys_begin;
+  const int p = static_cast<int>(std::max<long>(
+      1, std::min<long>(Par::max_threads(), n / sort_serial_cutoff)));
+
+  std::vector<Pair> zipped(n);
+  Pair* z = zipped.data();
+  Par::run(p, [=](int t) {
+    const long i1 = block_begin(n, p, t + 1);
+    for (long i = block_begin(n, p, t); i < i1; ++i) {
+      z[i] = Pair(std::move(*(keys_begin + i)), std::move(*(vals + i)));
+    }
+  });
+
+  merge_sort<Par, Stable>(z, z + n, compare_first<Pair, Compare>{comp});
+
+  Par::run(p, [=](int t) {
+    const long i1 = block_begin(n, p, t + 1);
+    for (long i = block_begin(n, p, t); i < i1; ++i) {
+      *(keys_begin + i) = std::move(z[i].first);
+      *(vals + i) = std::move(z[i].second);
+    }
+  });
+}
+
+}  // namespace detail
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_SORT_HPP */
@@ -149,6 +149,71 @@ struct CallForallIcount {
 
   const int start;
 };
+
+/// Makes a segment call on iterations [begin, end) of the segment
+template <typename Call>
+struct CallSlice {
+  template <typename T, typename ExecPol, typename Body>
+  RAJA_INLINE void operator()(T const& segment, ExecPol p, Body body) const
+  {
+    call(segment.slice(begin, end - begin), p, body);
+  }
+
+  const Call call;
+  const Index_type begin;
+  const Index_type end;
+};
+
+///
+/// Loop body that segment iteration policies call with a segment id, to
+/// execute that segment with the segment execution policy. Policies that
+/// split segments also call it with an id and iterations [begin, end) of
+/// the segment, which requires the segment type to provide slice().
+///
+template <typename IndexSetT, typename SegmentExecPolicy, typename LoopBody>
+struct IndexSetSegmentBody {
+  RAJA_INLINE void operator()(int segID) const
+  {
+    iset->segmentCall(segID, CallForall{}, SegmentExecPolicy(), body);
+  }
+
+  RAJA_INLINE void operator()(int segID, Index_type begin, Index_type end) const
+  {
+    iset->segmentCall(segID,
+                      CallSlice<CallForall>{CallForall{}, begin, end},
+                      SegmentExecPolicy(),
+                      body);
+  }
+
+  const IndexSetT* iset;
+  LoopBody body;
+};
+
+/// IndexSetSegmentBody for forall_Icount
+template <typename IndexSetT, typename SegmentExecPolicy, typename LoopBody>
+struct IndexSetSegmentIcountBody {
+  RAJA_INLINE void operator()(int segID) const
+  {
+    iset->segmentCall(segID,
+                      CallForallIcount(iset->getStartingIcount(segID)),
+                      SegmentExecPolicy(),
+                      body);
+  }
+
+  RAJA_INLINE void operator()(int segID, Index_type begin, Index_type end) const
+  {
+    const int start = iset->getStartingIcount(segID) + begin;
+    iset->segmentCall(segID,
+                      CallSlice<CallForallIcount>{CallForallIcount(start),
+                                                  begin,
+                                                  end},
+                      SegmentExecPolicy(),
+                      body);
+  }
+
+  const IndexSetT* iset;
+  LoopBody body;
+};
 }  // namespace detail
 
 /*!
@@ -236,12 +301,11 @@ RAJA_INLINE void forall_Icount(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
   auto body = trigger_updates_before(loop_body);
 
   // no need for icount variant here
-  wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
-    iset.segmentCall(segID,
-                     detail::CallForallIcount(iset.getStartingIcount(segID)),
-                     SegmentExecPolicy(),
-                     body);
-  });
+  using segment_body =
+      detail::IndexSetSegmentIcountBody<TypedIndexSet<SegmentTypes...>,
+                                        SegmentExecPolicy,
+                                        decltype(body)>;
+  wrap::forall(SegmentIterPolicy(), iset, segment_body{&iset, body});
 }
 
 template <typename SegmentIterPolicy,
@@ -256,9 +320,11 @@ RAJA_INLINE void forall(ExecPolicy<SegmentIterPolicy, SegmentExecPolicy>,
   using RAJA::internal::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
-  wrap::forall(SegmentIterPolicy(), iset, [=](int segID) {
-    iset.segmentCall(segID, detail::CallForall{}, SegmentExecPolicy(), body);
-  });
+  using segment_body =
+      detail::IndexSetSegmentBody<TypedIndexSet<SegmentTypes...>,
+                                  SegmentExecPolicy,
+                                  decltype(body)>;
+  wrap::forall(SegmentIterPolicy(), iset, segment_body{&iset, body});
 }
 
 }  // end namespace wrap
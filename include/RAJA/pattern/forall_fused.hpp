@@ -0,0 +1,217 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA forall_fused, which runs several loop
+ *          bodies over one iteration space in a single traversal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_HPP
+#define RAJA_forall_fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/Iterators.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Loop body that calls each of several bodies, in order, for one
+ *        index.
+ */
+template <typename... Bodies>
+struct FusedBody {
+  camp::tuple<Bodies...> bodies;
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args... args)
+  {
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, args...);
+  }
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args... args) const
+  {
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, args...);
+  }
+
+private:
+  // the braced list guarantees the bodies run in order
+  template <camp::idx_t... Is, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>, Args... args)
+  {
+    int order[] = {0, (camp::get<Is>(bodies)(args...), 0)...};
+    (void)order;
+  }
+
+  template <camp::idx_t... Is, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         Args... args) const
+  {
+    int order[] = {0, (camp::get<Is>(bodies)(args...), 0)...};
+    (void)order;
+  }
+};
+
+/*!
+ * \brief Loop body over chunk ids that runs each of several bodies, in
+ *        order, over all indices of one chunk of a random access container.
+ */
+template <typename Iterator, camp::idx_t ChunkSize, typename... Bodies>
+struct FusedChunkBody {
+  using diff_t = typename std::iterator_traits<Iterator>::difference_type;
+
+  Iterator begin;
+  diff_t len;
+  camp::tuple<Bodies...> bodies;
+
+  template <typename ChunkId>
+  RAJA_INLINE void operator()(ChunkId chunk)
+  {
+    diff_t lo = static_cast<diff_t>(chunk) * ChunkSize;
+    diff_t hi = lo + ChunkSize < len ? lo + ChunkSize : len;
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, lo, hi);
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_INLINE void call(camp::idx_seq<Is...>, diff_t lo, diff_t hi)
+  {
+    int order[] = {0, (run(camp::get<Is>(bodies), lo, hi), 0)...};
+    (void)order;
+  }
+
+  template <typename Body>
+  RAJA_INLINE void run(Body& body, diff_t lo, diff_t hi)
+  {
+    for (diff_t i = lo; i < hi; ++i) {
+      body(begin[i]);
+    }
+  }
+};
+
+template <typename ExecutionPolicy, typename Container, typename... Bodies>
+RAJA_INLINE void forall_fused_chunks(std::integral_constant<camp::idx_t, 0>,
+                                     Container&& c,
+                                     Bodies&&... bodies)
+{
+  using body_t = FusedBody<camp::decay<Bodies>...>;
+
+  forall<ExecutionPolicy>(std::forward<Container>(c),
+                          body_t{camp::make_tuple(bodies...)});
+}
+
+template <typename ExecutionPolicy,
+          camp::idx_t ChunkSize,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE void forall_fused_chunks(
+    std::integral_constant<camp::idx_t, ChunkSize>,
+    Container&& c,
+    Bodies&&... bodies)
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "forall_fused with a chunk size requires a random access "
+                "container; use a chunk size of 0 with index sets");
+
+  using std::begin;
+  using std::end;
+  using iterator_t = decltype(begin(c));
+  using body_t =
+      FusedChunkBody<iterator_t, ChunkSize, camp::decay<Bodies>...>;
+  using diff_t = typename body_t::diff_t;
+
+  diff_t len = std::distance(begin(c), end(c));
+  diff_t num_chunks = (len + ChunkSize - 1) / ChunkSize;
+
+  forall<ExecutionPolicy>(TypedRangeSegment<diff_t>(0, num_chunks),
+                          body_t{begin(c), len, camp::make_tuple(bodies...)});
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Run several loop bodies over one iteration space in a single
+ *         traversal.
+ *
+ * \code
+ *
+ *   RAJA::forall_fused<RAJA::omp_parallel_for_exec>(
+ *       RAJA::RangeSegment(0, N),
+ *       [=](int i) { a[i] = b[i] + c[i]; },
+ *       [=](int i) { d[i] = 2.0 * a[i]; });
+ *
+ * \endcode
+ *
+ * With the default ChunkSize of 0 the bodies are interleaved per index:
+ * for every index, body0 runs, then body1, and so on. This gives the same
+ * result as one forall per body when each body only reads values that
+ * earlier bodies wrote at the same index. Any container forall accepts,
+ * including index sets, may be used.
+ *
+ * With ChunkSize > 0 a random access container is split into chunks of
+ * ChunkSize indices; chunks are run with ExecutionPolicy and, within a
+ * chunk, body0 runs over all indices of the chunk, then body1, and so on.
+ * Later bodies may then read any value written by earlier bodies in the
+ * same chunk, and bodies are not interleaved within each index, which
+ * keeps each body's inner loop simple.
+ *
+ * Bodies are copied once into the fused body, which is then privatized by
+ * ExecutionPolicy like any other loop body, so reducers captured by the
+ * bodies work as they do with forall.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          camp::idx_t ChunkSize = 0,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE void forall_fused(Container&& c, Bodies&&... bodies)
+{
+  static_assert(sizeof...(Bodies) > 0, "forall_fused requires a loop body");
+  static_assert(ChunkSize >= 0, "ChunkSize must not be negative");
+
+  detail::forall_fused_chunks<ExecutionPolicy>(
+      std::integral_constant<camp::idx_t, ChunkSize>{},
+      std::forward<Container>(c),
+      std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
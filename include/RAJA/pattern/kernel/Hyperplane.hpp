@@ -50,7 +50,7 @@ namespace statement
  * Given segments S0, S1, ...
  * and iterates i0, i1, ... that range from 0 to Ni, where Ni = length(Si),
  * hyperplanes are defined as h = i0 + i1 + i2 + ...
- * For h = 0 ... sum(Ni)
+ * For h = 0 ... sum(Ni - 1)
  *
  * The iteration is advanced for
  *
@@ -59,30 +59,33 @@ namespace statement
  * Where HpArg is the argument id for i0, and Args define the arguments ids for
  * i1, i2, ...
  *
- *
- *
+ * Only the points of each hyperplane are visited: the bounds of i1, i2, ...
+ * are computed exactly for each h, so a sweep does work proportional to the
+ * size of the iteration space.
  *
  * The implemented loop pattern looks like:
  *
  *  RAJA::forall<HpExecPolicy>(RangeSegment(0, Nh), [=](RAJA::Index_type h){
  *
- *     RAJA::kernel::forall<Collapse<ExecPolicy, ArgList<1,2,...>, Lambda<0>>>(
- *        RAJA::make_tuple(S1, S2, ...),
- *        [=](RAJA::Index_type i1, RAJA::Index_type i2, ...){
+ *     RAJA::forall<ExecPolicy>(RangeSegment(lo1(h), hi1(h)),
+ *                              [=](RAJA::Index_type i1){
  *
- *          // Compute i0
- *          RAJA::Index_type i0 = h - sum(i1, i2, ...);
+ *       for (i2 = lo2(h, i1); i2 < hi2(h, i1); ++i2) {
+ *         ...
+ *            // Compute i0, which is always in bounds
+ *            RAJA::Index_type i0 = h - sum(i1, i2, ...);
  *
- *          // Check if h is in bounds
- *          if(h >= 0 && h < Nh){
+ *            loop_body(i0, i1, i2, ...);
+ *       }
  *
-              loop_body(i0, i1, i2, ...);
- *          }
- *
- *        });
+ *     });
  *
  *  });
  *
+ * HpExecPolicy must run hyperplanes in order (e.g. seq_exec), and
+ * ExecPolicy is a forall policy such as omp_parallel_for_exec or
+ * tbb_for_dynamic that runs the points of a hyperplane concurrently.
+ *
  */
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
@@ -94,6 +97,29 @@ struct Hyperplane
                                  EnclosedStmts...> {
 };
 
+/*!
+ * A RAJA::kernel statement that performs a blocked hyperplane (wavefront)
+ * iteration over multiple indices.
+ *
+ * The iteration space is divided into blocks of BlockSize iterates in each
+ * index, and Hyperplane iteration is applied to the block indices. The
+ * blocks of a hyperplane run concurrently under ExecPolicy, and the points
+ * of each block run in lexicographic order. This preserves the ordering of
+ * a Hyperplane sweep while synchronizing about BlockSize times less often.
+ *
+ */
+template <camp::idx_t HpArgumentId,
+          camp::idx_t BlockSize,
+          typename HpExecPolicy,
+          typename ArgList,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct BlockedHyperplane
+    : public internal::Statement<RAJA::ExecPolicy<HpExecPolicy, ExecPolicy>,
+                                 EnclosedStmts...> {
+  static_assert(BlockSize > 0, "BlockSize must be positive");
+};
+
 }  // end namespace statement
 
 namespace internal
@@ -106,6 +132,208 @@ struct HyperplaneInner
 };
 
 
+/*!
+ * Extents of a box of Dims indices, where index 0 is the hyperplane index,
+ * and enumeration of the points on a hyperplane h = i0 + i1 + ...
+ */
+template <typename IndexType, size_t Dims>
+struct HyperplaneBox {
+  static_assert(Dims > 1, "Hyperplane requires at least one index in ArgList");
+
+  using idx_t = IndexType;
+
+  idx_t len[Dims];
+
+  // rem[j] is the largest value of i_j + ... + i_(Dims-1), for j >= 1
+  idx_t rem[Dims + 1];
+
+  template <typename... Lengths>
+  RAJA_INLINE explicit HyperplaneBox(Lengths... lengths)
+      : len{static_cast<idx_t>(lengths)...}
+  {
+    rem[Dims] = 0;
+    for (size_t j = Dims - 1; j >= 1; --j) {
+      rem[j] = rem[j + 1] + len[j] - 1;
+    }
+  }
+
+  RAJA_INLINE idx_t num_planes() const
+  {
+    for (size_t j = 0; j < Dims; ++j) {
+      if (len[j] <= 0) return 0;
+    }
+    return len[0] + rem[1];
+  }
+
+  //! range [lo, hi] of index j >= 1, where t = i0 + i_j + ... + i_(Dims-1)
+  RAJA_INLINE void bounds(size_t j, idx_t t, idx_t &lo, idx_t &hi) const
+  {
+    lo = t - (len[0] - 1) - rem[j + 1];
+    if (lo < 0) lo = 0;
+    hi = t < len[j] - 1 ? t : len[j] - 1;
+  }
+
+  //! calls f(c) for every point c whose indices c[j], c[j+1], ... and c[0]
+  //! sum to t, with c[1], ..., c[j-1] already set
+  template <typename Func>
+  RAJA_INLINE void visit(size_t j, idx_t t, idx_t *c, Func &&f) const
+  {
+    if (j == Dims) {
+      c[0] = t;
+      f(c);
+      return;
+    }
+    idx_t lo, hi;
+    bounds(j, t, lo, hi);
+    for (idx_t i = lo; i <= hi; ++i) {
+      c[j] = i;
+      visit(j + 1, t - i, c, f);
+    }
+  }
+
+  //! calls f(c) for every point c of block b, with blocks of size block
+  template <typename Func>
+  RAJA_INLINE void visit_block(size_t j,
+                               idx_t block,
+                               idx_t const *b,
+                               idx_t *c,
+                               Func &&f) const
+  {
+    if (j == Dims) {
+      f(c);
+      return;
+    }
+    idx_t end = (b[j] + 1) * block;
+    if (end > len[j]) end = len[j];
+    for (idx_t i = b[j] * block; i < end; ++i) {
+      c[j] = i;
+      visit_block(j + 1, block, b, c, f);
+    }
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Args,
+          camp::idx_t... Is,
+          typename Data,
+          typename IndexType>
+RAJA_INLINE void hyperplane_assign(Data &data,
+                                   ArgList<Args...> const &,
+                                   camp::idx_seq<Is...> const &,
+                                   IndexType const *c)
+{
+  data.template assign_offset<HpArgumentId>(c[0]);
+  VarOps::ignore_args((data.template assign_offset<Args>(c[Is + 1]), 0)...);
+}
+
+
+/*!
+ * Runs the points of hyperplane h that have i1 equal to the loop index,
+ * or with BlockSize > 0, the blocks of block hyperplane h that have block
+ * index b1 equal to the loop index.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ArgList,
+          camp::idx_t BlockSize,
+          typename Box,
+          typename Data,
+          typename... EnclosedStmts>
+struct HyperplaneRowWrapper : public GenericWrapperBase {
+  using data_t = camp::decay<Data>;
+  using idx_t = typename Box::idx_t;
+  using seq_t = camp::make_idx_seq_t<camp::size<ArgList>::value>;
+
+  data_t &data;
+  Box const &box;
+  Box const &blocks;
+  idx_t h;
+
+  RAJA_INLINE
+  HyperplaneRowWrapper(data_t &d, Box const &box_, Box const &blocks_, idx_t h_)
+      : data(d), box(box_), blocks(blocks_), h(h_)
+  {
+  }
+
+  struct privatizer {
+    using value_type = HyperplaneRowWrapper;
+    using reference_type = value_type &;
+
+    data_t privatized_data;
+    value_type privatized_wrapper;
+
+    RAJA_INLINE
+    privatizer(const HyperplaneRowWrapper &o)
+        : privatized_data{o.data},
+          privatized_wrapper(privatized_data, o.box, o.blocks, o.h)
+    {
+    }
+
+    RAJA_INLINE
+    reference_type get_priv() { return privatized_wrapper; }
+  };
+
+  RAJA_INLINE void exec_point(idx_t const *c)
+  {
+    hyperplane_assign<HpArgumentId>(data, ArgList{}, seq_t{}, c);
+    execute_statement_list<camp::list<EnclosedStmts...>>(data);
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType i)
+  {
+    idx_t c[camp::size<ArgList>::value + 1];
+    c[1] = i;
+    if (BlockSize == 0) {
+      box.visit(2, h - c[1], c, [&](idx_t const *p) { exec_point(p); });
+    } else {
+      idx_t b[camp::size<ArgList>::value + 1];
+      b[1] = i;
+      blocks.visit(2, h - b[1], b, [&](idx_t const *pb) {
+        box.visit_block(0, BlockSize, pb, c, [&](idx_t const *p) {
+          exec_point(p);
+        });
+      });
+    }
+  }
+};
+
+
+/*!
+ * Runs hyperplanes 0 ... num_planes - 1 of blocks in order, running the
+ * rows of each hyperplane under ExecPolicy.
+ */
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          typename ArgList,
+          typename ExecPolicy,
+          camp::idx_t BlockSize,
+          typename... EnclosedStmts,
+          typename Data,
+          typename Box>
+RAJA_INLINE void hyperplane_sweep(Data &data, Box const &box, Box const &blocks)
+{
+  using idx_t = typename Box::idx_t;
+  using row_t = HyperplaneRowWrapper<HpArgumentId,
+                                     ArgList,
+                                     BlockSize,
+                                     Box,
+                                     Data,
+                                     EnclosedStmts...>;
+
+  forall_impl(HpExecPolicy{},
+              TypedRangeSegment<idx_t>(0, blocks.num_planes()),
+              [&](idx_t h) {
+                idx_t lo, hi;
+                blocks.bounds(1, h, lo, hi);
+                row_t row(data, box, blocks, h);
+                forall_impl(ExecPolicy{},
+                            TypedRangeSegment<idx_t>(lo, hi + 1),
+                            row);
+              });
+}
+
+
 template <camp::idx_t HpArgumentId,
           typename HpExecPolicy,
           camp::idx_t... Args,
@@ -126,32 +354,58 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
     using data_t = camp::decay<Data>;
     using idx_t =
         camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
+    using box_t = HyperplaneBox<idx_t, sizeof...(Args) + 1>;
+
+    box_t box(segment_length<HpArgumentId>(data),
+              segment_length<Args>(data)...);
 
-    // Add a Collapse policy around our enclosed statements that will handle
-    // the inner hyperplane loop's execution
-    using kernel_policy = statement::Collapse<
-        ExecPolicy,
-        ArgList<Args...>,
-        HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>>;
-
-    // Create a For-loop wrapper for the outer loop
-    ForWrapper<HpArgumentId, Data, kernel_policy> outer_wrapper(data);
-
-    // compute manhattan distance of iteration space to determine
-    // as:  hp_len = l0 + l1 + l2 + ...
-    idx_t hp_len = segment_length<HpArgumentId>(data) +
-                   VarOps::foldl(RAJA::operators::plus<idx_t>(),
-                                 segment_length<Args>(data)...);
-
-    /* Execute the outer loop over hyperplanes
-     *
-     * This will store h in the index_tuple as argument HpArgumentId, so that
-     * later, the HyperplaneInner executor can pull it out, and calculate that
-     * arguments actual value (and restrict to valid hyperplane indices)
-     */
-    forall_impl(HpExecPolicy{},
-                TypedRangeSegment<idx_t>(0, hp_len),
-                outer_wrapper);
+    hyperplane_sweep<HpArgumentId,
+                     HpExecPolicy,
+                     ArgList<Args...>,
+                     ExecPolicy,
+                     0,
+                     EnclosedStmts...>(data, box, box);
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t BlockSize,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct StatementExecutor<statement::BlockedHyperplane<HpArgumentId,
+                                                      BlockSize,
+                                                      HpExecPolicy,
+                                                      ArgList<Args...>,
+                                                      ExecPolicy,
+                                                      EnclosedStmts...>> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+
+    using data_t = camp::decay<Data>;
+    using idx_t =
+        camp::tuple_element_t<HpArgumentId, typename data_t::offset_tuple_t>;
+    using box_t = HyperplaneBox<idx_t, sizeof...(Args) + 1>;
+
+    box_t box(segment_length<HpArgumentId>(data),
+              segment_length<Args>(data)...);
+
+    // number of blocks along each index
+    box_t blocks((segment_length<HpArgumentId>(data) + BlockSize - 1)
+                     / BlockSize,
+                 (segment_length<Args>(data) + BlockSize - 1) / BlockSize...);
+
+    hyperplane_sweep<HpArgumentId,
+                     HpExecPolicy,
+                     ArgList<Args...>,
+                     ExecPolicy,
+                     BlockSize,
+                     EnclosedStmts...>(data, box, blocks);
   }
 };
 
@@ -28,6 +28,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <type_traits>
 
@@ -35,6 +36,7 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/util/CacheInfo.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -63,12 +65,65 @@ struct tile_fixed {
   static constexpr camp::idx_t chunk_size = chunk_size_;
 };
 
+/*!
+ * Tag for a tiling loop whose tile size is chosen at runtime so that a tile
+ * fits in half of the level CacheLevel data cache (see getCacheSize).
+ *
+ * BytesPerIter is the memory touched per point of the tiled iteration
+ * space, summed over all arrays accessed. When NumDims nested loops use the
+ * same tile_cache policy, each gets a tile extent of
+ * (cache / 2 / BytesPerIter)^(1/NumDims), so the whole NumDims-dimensional
+ * tile fits. Extents of 16 or more are rounded down to a multiple of 8.
+ *
+ * Tile sizes are not compile-time constants, so tile_cache can not be used
+ * with ShmemTile or the CUDA kernel policies.
+ */
+template <camp::idx_t BytesPerIter,
+          camp::idx_t NumDims = 1,
+          int CacheLevel = 2>
+struct tile_cache {
+  static_assert(BytesPerIter > 0, "BytesPerIter must be positive");
+  static_assert(NumDims > 0, "NumDims must be positive");
+
+  static camp::idx_t chunk_size()
+  {
+    static const camp::idx_t size = compute_chunk_size();
+    return size;
+  }
+
+private:
+  static camp::idx_t compute_chunk_size()
+  {
+    double points =
+        static_cast<double>(getCacheSize(CacheLevel)) / 2 / BytesPerIter;
+    camp::idx_t size =
+        static_cast<camp::idx_t>(std::pow(points, 1.0 / NumDims) + 1e-9);
+    if (size >= 16) size -= size % 8;
+    return size < 1 ? 1 : size;
+  }
+};
+
 
 }  // end namespace statement
 
 namespace internal
 {
 
+//! tile size used by a tiling policy
+template <typename TilePolicy>
+struct TileSize {
+  static constexpr camp::idx_t get() { return TilePolicy::chunk_size; }
+};
+
+template <camp::idx_t BytesPerIter, camp::idx_t NumDims, int CacheLevel>
+struct TileSize<statement::tile_cache<BytesPerIter, NumDims, CacheLevel>> {
+  static camp::idx_t get()
+  {
+    return statement::tile_cache<BytesPerIter, NumDims, CacheLevel>::
+        chunk_size();
+  }
+};
+
 
 template <camp::idx_t ArgumentId, typename Data, typename... EnclosedStmts>
 struct TileWrapper : public GenericWrapper<Data, EnclosedStmts...> {
@@ -211,7 +266,7 @@ struct StatementExecutor<
     auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
 
     // Get the tiling policies chunk size
-    auto chunk_size = TPol::chunk_size;
+    auto chunk_size = TileSize<TPol>::get();
 
     // Create a tile iterator, needs to survive until the forall is
     // done executing.
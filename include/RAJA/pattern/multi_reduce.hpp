@@ -0,0 +1,128 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file providing RAJA multi-reduction declarations.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_multi_reduce_HPP
+#define RAJA_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+namespace RAJA
+{
+
+//
+// Forward declarations for multi-reduction templates.
+// Actual classes appear in policy/*/multi_reduce.hpp header files.
+//
+// A multi-reducer holds a number of reduction bins chosen at runtime.
+// Each thread accumulates into its own privatized copy of the bins and
+// the copies are merged only when results are requested, so binning loops
+// do not need atomics.
+//
+// IMPORTANT: reduction policy parameter must be consistent with loop
+//            execution policy type.
+//
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Multi-bin min reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Index_ptr bin = ...;
+   Real_ptr data = ...;
+   MultiReduceMin<reduce_policy, Real_type> my_mins(num_bins, init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_mins[bin[i]].min(data[i]);
+   }
+
+   Real_type min0 = my_mins.get(0);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class MultiReduceMin;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Multi-bin max reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Index_ptr bin = ...;
+   Real_ptr data = ...;
+   MultiReduceMax<reduce_policy, Real_type> my_maxs(num_bins, init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_maxs[bin[i]].max(data[i]);
+   }
+
+   std::vector<Real_type> maxs = my_maxs.get_all();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class MultiReduceMax;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Multi-bin sum reducer class template.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Index_ptr bin = ...;
+   Real_ptr data = ...;
+   MultiReduceSum<reduce_policy, Real_type> my_sums(num_bins, init_val);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_sums[bin[i]] += data[i];
+   }
+
+   Real_type sums[num_bins];
+   my_sums.get_all(sums);
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename T>
+class MultiReduceSum;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
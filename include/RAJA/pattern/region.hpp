@@ -46,6 +46,32 @@ void region(OuterBody&& outer_body, InnerBody&& inner_body)
   region_impl(ExecutionPolicy(), outer_body, inner_body);
 }
 
+/*!
+ * \brief Wait, inside a region, until all threads of the region reach this
+ *        point; marks a dependency between the loops before and after it.
+ */
+template <typename ExecutionPolicy>
+void region_sync()
+{
+  region_sync_impl(ExecutionPolicy());
+}
+
+/*!
+ * \brief Value of a reducer updated by the preceding loops of a region,
+ *        returned on every thread of the region.
+ *
+ * Synchronizes before reading, so all threads have contributed, and after,
+ * so no thread updates the reducer again before all have read it.
+ */
+template <typename ExecutionPolicy, typename Reducer>
+auto region_get(Reducer const& reducer) -> decltype(reducer.get())
+{
+  region_sync<ExecutionPolicy>();
+  auto value = reducer.get();
+  region_sync<ExecutionPolicy>();
+  return value;
+}
+
 }  // namespace RAJA
 
 
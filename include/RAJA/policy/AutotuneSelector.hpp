@@ -0,0 +1,130 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA MultiPolicy selector that picks the fastest policy by timing
+ *          each candidate.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AutotuneSelector_HPP
+#define RAJA_AutotuneSelector_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+// number of iterations of an index set or of a segment
+template <typename Iterable>
+auto autotune_length(Iterable const &iter, int)
+    -> decltype(static_cast<size_t>(iter.getLength()))
+{
+  return static_cast<size_t>(iter.getLength());
+}
+
+template <typename Iterable>
+size_t autotune_length(Iterable const &iter, long)
+{
+  using std::begin;
+  using std::end;
+  return static_cast<size_t>(std::distance(begin(iter), end(iter)));
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  MultiPolicy selector that times each candidate policy and then
+ *         keeps using the fastest one.
+ *
+ * Iteration spaces are grouped into buckets by length, one per power of
+ * two. While a bucket is being tuned, each forall call in it runs the
+ * candidate with the fewest timed runs so far. Once every candidate has been
+ * timed trials times, the candidate with the lowest time per iteration is
+ * chosen for the bucket and used from then on.
+ *
+ * Choices are saved to a file and loaded again by selectors created later,
+ * in this run or in later runs, with the same site name and number of
+ * candidates. The file is given to the constructor or, if that is empty,
+ * by the RAJA_AUTOTUNE_FILE environment variable. With neither, nothing is
+ * saved. Since the best choice depends on the machine, use one file per
+ * machine type. Delete the file to tune again.
+ *
+ * Copies of a selector share their timings, so a selector may be copied
+ * into loops that run at the same time.
+ *
+ ******************************************************************************
+ */
+class AutotuneSelector
+{
+public:
+  /*!
+   * \brief Create a selector for num_policies candidates; site names the
+   *        call site in the file and must be unique to it.
+   */
+  AutotuneSelector(std::string site,
+                   int num_policies,
+                   std::string file = std::string(),
+                   int trials = 3);
+
+  //! index of the policy to run for iter
+  template <typename Iterable>
+  int operator()(Iterable const &iter) const
+  {
+    return select(detail::autotune_length(iter, 0));
+  }
+
+  //! record that running policy on iter took seconds; called by MultiPolicy
+  template <typename Iterable>
+  void report(Iterable const &iter, int policy, double seconds) const
+  {
+    record(detail::autotune_length(iter, 0), policy, seconds);
+  }
+
+  //! index of the policy to run for an iteration space of this length
+  int select(size_t length) const;
+
+  //! record that running policy on length iterations took seconds
+  void record(size_t length, int policy, double seconds) const;
+
+  //! policy chosen for this length, or -1 while it is still being tuned
+  int chosen(size_t length) const;
+
+  //! bucket holding iteration spaces of this length
+  static int bucket(size_t length);
+
+private:
+  struct state;
+  std::shared_ptr<state> m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
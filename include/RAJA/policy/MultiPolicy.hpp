@@ -29,12 +29,16 @@
 #include "RAJA/config.hpp"
 
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "RAJA/internal/LegacyCompatibility.hpp"
 
+#include "RAJA/policy/AutotuneSelector.hpp"
 #include "RAJA/policy/PolicyBase.hpp"
 
 #include "RAJA/util/chai_support.hpp"
+#include "RAJA/util/Timer.hpp"
 #include "RAJA/util/concepts.hpp"
 
 namespace RAJA
@@ -44,7 +48,24 @@ namespace detail
 {
 template <size_t index, size_t size, typename Policy, typename... rest>
 struct policy_invoker;
-}
+
+/// selector_reports - true if Selector has a report(iterable, index,
+/// seconds) member to receive the run time of the selected policy
+template <typename Selector, typename Iterable, typename Enable = void>
+struct selector_reports : std::false_type {
+};
+
+template <typename Selector, typename Iterable>
+struct selector_reports<
+    Selector,
+    Iterable,
+    decltype(std::declval<Selector &>().report(
+                 std::declval<typename std::decay<Iterable>::type const &>(),
+                 0,
+                 0.0),
+             void())> : std::true_type {
+};
+}  // namespace detail
 
 namespace policy
 {
@@ -73,14 +94,32 @@ public:
   template <typename Iterable, typename Body>
   int invoke(Iterable &&i, Body &&b)
   {
-    size_t index = s(i);
-    _policies.invoke(index, i, b);
-    return s(i);
+    int index = s(i);
+    run(detail::selector_reports<Selector, Iterable>{}, index, i, b);
+    return index;
   }
 
   detail::
       policy_invoker<sizeof...(Policies) - 1, sizeof...(Policies), Policies...>
           _policies;
+
+private:
+  template <typename Iterable, typename Body>
+  void run(std::false_type, int index, Iterable &&i, Body &&b)
+  {
+    _policies.invoke(index, i, b);
+  }
+
+  // selectors with a report() member are told how long the policy took
+  template <typename Iterable, typename Body>
+  void run(std::true_type, int index, Iterable &&i, Body &&b)
+  {
+    Timer timer;
+    timer.start();
+    _policies.invoke(index, i, b);
+    timer.stop();
+    s.report(i, index, timer.elapsed());
+  }
 };
 
 /// forall_impl - MultiPolicy specialization, select at runtime from a
@@ -147,6 +186,25 @@ auto make_multi_policy(std::tuple<Policies...> policies, Selector s)
       VarOps::make_index_sequence<sizeof...(Policies)>{}, s, policies);
 }
 
+/// make_autotune_policy - Construct a MultiPolicy that chooses between
+/// Policies with an AutotuneSelector
+///
+/// \tparam Policies list of policies, 0 to N-1
+/// \param site name of the call site, used as its key in file
+/// \param file file to load and save choices, see AutotuneSelector
+/// \param trials timed runs of each policy before choosing one
+/// \return A MultiPolicy whose selector autotunes between Policies
+template <typename... Policies>
+MultiPolicy<AutotuneSelector, Policies...> make_autotune_policy(
+    std::string site,
+    std::string file = std::string(),
+    int trials = 3)
+{
+  return MultiPolicy<AutotuneSelector, Policies...>(
+      AutotuneSelector(site, sizeof...(Policies), file, trials),
+      Policies{}...);
+}
+
 namespace detail
 {
 
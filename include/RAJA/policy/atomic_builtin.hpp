@@ -28,9 +28,28 @@
 
 #include "RAJA/config.hpp"
 
+#include <type_traits>
+
 #include "RAJA/util/TypeConvert.hpp"
 #include "RAJA/util/macros.hpp"
 
+#if defined(RAJA_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+// compilers that provide lock-free fetch-min/max builtins (clang)
+#if defined(__has_builtin)
+#if __has_builtin(__atomic_fetch_min) && __has_builtin(__atomic_fetch_max)
+#define RAJA_HAVE_BUILTIN_ATOMIC_MINMAX
+#endif
+#endif
+
+// compilers whose __atomic_fetch_add/sub accept floating point types
+#if defined(__clang__) && !defined(__apple_build_version__) \
+    && (__clang_major__ >= 13)
+#define RAJA_HAVE_BUILTIN_ATOMIC_FLOAT
+#endif
+
 namespace RAJA
 {
 namespace atomic
@@ -95,6 +114,43 @@ RAJA_INLINE T atomicCAS(builtin_atomic, T volatile *acc, T compare, T value)
 namespace detail
 {
 
+//! hint to the processor that this thread is spinning
+RAJA_INLINE void builtin_atomic_pause()
+{
+#if defined(RAJA_COMPILER_MSVC)
+#if defined(_M_IX86) || defined(_M_X64)
+  _mm_pause();
+#endif
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+/*!
+ * Exponential backoff between the retries of a CAS loop. Threads that lost
+ * the race wait longer each time instead of all hitting the cache line again
+ * at once, which otherwise makes CAS loops on a hot address livelock.
+ */
+class BuiltinAtomicBackoff
+{
+public:
+  RAJA_INLINE void operator()()
+  {
+    for (unsigned i = 0; i < m_spins; ++i) {
+      builtin_atomic_pause();
+    }
+    if (m_spins < max_spins) {
+      m_spins *= 2;
+    }
+  }
+
+private:
+  static constexpr unsigned max_spins = 64;
+  unsigned m_spins = 1;
+};
+
 template <size_t BYTES>
 struct BuiltinAtomicCAS;
 template <size_t BYTES>
@@ -118,6 +174,7 @@ struct BuiltinAtomicCAS<4> {
                            ShortCircuit const &sc) const
   {
     unsigned oldval, newval, readback;
+    BuiltinAtomicBackoff backoff;
 
     oldval = RAJA::util::reinterp_A_as_B<T, unsigned>(*acc);
     newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
@@ -126,6 +183,7 @@ struct BuiltinAtomicCAS<4> {
     while ((readback = RAJA::atomic::atomicCAS(
                 builtin_atomic{}, (unsigned *)acc, oldval, newval)) != oldval) {
       if (sc(readback)) break;
+      backoff();
       oldval = readback;
       newval = RAJA::util::reinterp_A_as_B<T, unsigned>(
           oper(RAJA::util::reinterp_A_as_B<unsigned, T>(oldval)));
@@ -148,6 +206,7 @@ struct BuiltinAtomicCAS<8> {
                            ShortCircuit const &sc) const
   {
     unsigned long long oldval, newval, readback;
+    BuiltinAtomicBackoff backoff;
 
     oldval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(*acc);
     newval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(
@@ -158,6 +217,7 @@ struct BuiltinAtomicCAS<8> {
                                                oldval,
                                                newval)) != oldval) {
       if (sc(readback)) break;
+      backoff();
       oldval = readback;
       newval = RAJA::util::reinterp_A_as_B<T, unsigned long long>(
           oper(RAJA::util::reinterp_A_as_B<unsigned long long, T>(oldval)));
@@ -190,20 +250,170 @@ RAJA_INLINE T builtin_atomic_CAS_oper_sc(T volatile *acc,
 }
 
 
+/*!
+ * Types with native fetch-and-op builtins: integers everywhere but MSVC,
+ * and floating point add/sub with compilers that support it. Everything
+ * else goes through the CAS loop.
+ */
+#if defined(RAJA_COMPILER_MSVC)
+template <typename T>
+using builtin_has_fetch_op = std::false_type;
+#else
+template <typename T>
+using builtin_has_fetch_op =
+    std::integral_constant<bool,
+                           std::is_integral<T>::value
+                               && !std::is_same<T, bool>::value>;
+#endif
+
+#if defined(RAJA_HAVE_BUILTIN_ATOMIC_FLOAT)
+template <typename T>
+using builtin_has_fetch_add =
+    std::integral_constant<bool,
+                           builtin_has_fetch_op<T>::value
+                               || std::is_floating_point<T>::value>;
+#else
+template <typename T>
+using builtin_has_fetch_add = builtin_has_fetch_op<T>;
+#endif
+
+#if defined(RAJA_HAVE_BUILTIN_ATOMIC_MINMAX)
+template <typename T>
+using builtin_has_fetch_minmax = builtin_has_fetch_op<T>;
+#else
+template <typename T>
+using builtin_has_fetch_minmax = std::false_type;
+#endif
+
+#if !defined(RAJA_COMPILER_MSVC)
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_add(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_add(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_sub(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_sub(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_and(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_and(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_or(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_or(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_xor(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_xor(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_exchange(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_exchange_n(acc, value, __ATOMIC_ACQ_REL);
+}
+
+#endif  // RAJA_COMPILER_MSVC
+
+#if defined(RAJA_HAVE_BUILTIN_ATOMIC_MINMAX)
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_min(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_min(acc, value, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_max(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_max(acc, value, __ATOMIC_ACQ_REL);
+}
+
+#endif  // RAJA_HAVE_BUILTIN_ATOMIC_MINMAX
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_add(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_sub(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a - value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_and(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a & value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_or(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a | value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_xor(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T a) { return a ^ value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_exchange(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+}
+
+// the CAS loop stops as soon as it sees a value that already wins, so
+// min/max never write when they would not change the value
+template <typename T>
+RAJA_INLINE T builtin_atomic_min(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper_sc(acc,
+                                    [=](T a) { return a < value ? a : value; },
+                                    [=](T current) { return current < value; });
+}
+
+template <typename T>
+RAJA_INLINE T builtin_atomic_max(T volatile *acc, T value, std::false_type)
+{
+  return builtin_atomic_CAS_oper_sc(acc,
+                                    [=](T a) { return a > value ? a : value; },
+                                    [=](T current) { return current > value; });
+}
+
+
 }  // namespace detail
 
 
 template <typename T>
 RAJA_INLINE T atomicAdd(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + value; });
+  return detail::builtin_atomic_add(acc,
+                                    value,
+                                    detail::builtin_has_fetch_add<T>{});
 }
 
 
 template <typename T>
 RAJA_INLINE T atomicSub(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - value; });
+  return detail::builtin_atomic_sub(acc,
+                                    value,
+                                    detail::builtin_has_fetch_add<T>{});
 }
 
 template <typename T>
@@ -212,13 +422,9 @@ RAJA_INLINE T atomicMin(builtin_atomic, T volatile *acc, T value)
   if (*acc < value) {
     return *acc;
   }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a < value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current < value;
-                                            });
+  return detail::builtin_atomic_min(acc,
+                                    value,
+                                    detail::builtin_has_fetch_minmax<T>{});
 }
 
 template <typename T>
@@ -227,19 +433,17 @@ RAJA_INLINE T atomicMax(builtin_atomic, T volatile *acc, T value)
   if (*acc > value) {
     return *acc;
   }
-  return detail::builtin_atomic_CAS_oper_sc(acc,
-                                            [=](T a) {
-                                              return a > value ? a : value;
-                                            },
-                                            [=](T current) {
-                                              return current > value;
-                                            });
+  return detail::builtin_atomic_max(acc,
+                                    value,
+                                    detail::builtin_has_fetch_minmax<T>{});
 }
 
 template <typename T>
 RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a + 1; });
+  return detail::builtin_atomic_add(acc,
+                                    static_cast<T>(1),
+                                    detail::builtin_has_fetch_add<T>{});
 }
 
 template <typename T>
@@ -253,7 +457,9 @@ RAJA_INLINE T atomicInc(builtin_atomic, T volatile *acc, T val)
 template <typename T>
 RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a - 1; });
+  return detail::builtin_atomic_sub(acc,
+                                    static_cast<T>(1),
+                                    detail::builtin_has_fetch_add<T>{});
 }
 
 template <typename T>
@@ -267,25 +473,33 @@ RAJA_INLINE T atomicDec(builtin_atomic, T volatile *acc, T val)
 template <typename T>
 RAJA_INLINE T atomicAnd(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a & value; });
+  return detail::builtin_atomic_and(acc,
+                                    value,
+                                    detail::builtin_has_fetch_op<T>{});
 }
 
 template <typename T>
 RAJA_INLINE T atomicOr(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a | value; });
+  return detail::builtin_atomic_or(acc,
+                                   value,
+                                   detail::builtin_has_fetch_op<T>{});
 }
 
 template <typename T>
 RAJA_INLINE T atomicXor(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T a) { return a ^ value; });
+  return detail::builtin_atomic_xor(acc,
+                                    value,
+                                    detail::builtin_has_fetch_op<T>{});
 }
 
 template <typename T>
 RAJA_INLINE T atomicExchange(builtin_atomic, T volatile *acc, T value)
 {
-  return detail::builtin_atomic_CAS_oper(acc, [=](T) { return value; });
+  return detail::builtin_atomic_exchange(acc,
+                                         value,
+                                         detail::builtin_has_fetch_op<T>{});
 }
 
 
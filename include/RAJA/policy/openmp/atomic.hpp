@@ -30,6 +30,8 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <type_traits>
+
 // rely on builtin_atomic when OpenMP can't do the job
 #include "RAJA/policy/atomic_builtin.hpp"
 
@@ -55,9 +57,24 @@ struct omp_atomic {
 };
 
 
+namespace detail
+{
+
+/*!
+ * OpenMP compilers implement floating point atomic updates with a bare CAS
+ * loop, so those go to builtin_atomic, which either has a native
+ * instruction or backs off under contention. builtin_atomic only has CAS
+ * loops on 4 and 8 bytes; other types, e.g. long double, stay on omp atomic.
+ */
+template <typename T>
+using omp_atomic_use_builtin =
+    std::integral_constant<bool,
+                           std::is_floating_point<T>::value
+                               && (sizeof(T) == 4 || sizeof(T) == 8)>;
+
 RAJA_SUPPRESS_HD_WARN
 template <typename T>
-RAJA_INLINE T atomicAdd(omp_atomic, T volatile *acc, T value)
+RAJA_INLINE T omp_atomic_add(T volatile *acc, T value, std::false_type)
 {
   T ret;
 #pragma omp atomic capture
@@ -68,10 +85,16 @@ RAJA_INLINE T atomicAdd(omp_atomic, T volatile *acc, T value)
   return ret;
 }
 
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_INLINE T omp_atomic_add(T volatile *acc, T value, std::true_type)
+{
+  return RAJA::atomic::atomicAdd(builtin_atomic{}, acc, value);
+}
 
 RAJA_SUPPRESS_HD_WARN
 template <typename T>
-RAJA_INLINE T atomicSub(omp_atomic, T volatile *acc, T value)
+RAJA_INLINE T omp_atomic_sub(T volatile *acc, T value, std::false_type)
 {
   T ret;
 #pragma omp atomic capture
@@ -82,6 +105,35 @@ RAJA_INLINE T atomicSub(omp_atomic, T volatile *acc, T value)
   return ret;
 }
 
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_INLINE T omp_atomic_sub(T volatile *acc, T value, std::true_type)
+{
+  return RAJA::atomic::atomicSub(builtin_atomic{}, acc, value);
+}
+
+}  // namespace detail
+
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_INLINE T atomicAdd(omp_atomic, T volatile *acc, T value)
+{
+  return detail::omp_atomic_add(acc,
+                                value,
+                                detail::omp_atomic_use_builtin<T>{});
+}
+
+
+RAJA_SUPPRESS_HD_WARN
+template <typename T>
+RAJA_INLINE T atomicSub(omp_atomic, T volatile *acc, T value)
+{
+  return detail::omp_atomic_sub(acc,
+                                value,
+                                detail::omp_atomic_use_builtin<T>{});
+}
+
 
 RAJA_SUPPRESS_HD_WARN
 template <typename T>
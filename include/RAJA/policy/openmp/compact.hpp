@@ -0,0 +1,158 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_openmp_HPP
+#define RAJA_compact_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/scan.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace detail
+{
+
+//! number of indices in one chunk; keep is evaluated for a chunk while its
+//! input is still in cache
+const int compact_chunk = 16 * 1024;
+
+}  // namespace detail
+
+/*!
+        \brief emit every index in [0, n) for which keep holds at its rank
+   among the kept indices; returns the number kept
+
+        Runs as a single-pass lookback scan over the kept counts of each
+        chunk: a chunk counts its kept indices, learns how many were kept
+        before it, and emits its own while the input is still in cache.
+*/
+template <typename Policy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_openmp_policy<Policy>::value,
+                        Index>::type
+select(const Policy&, Index n, Keep keep, Emit emit)
+{
+  return scan::detail::lookback_scan(
+      n,
+      Index(detail::compact_chunk),
+      ::std::plus<Index>{},
+      Index(0),
+      true,
+      [=](Index i0, Index i1) {
+        Index count = 0;
+        for (Index i = i0; i < i1; ++i) {
+          count += keep(i) ? 1 : 0;
+        }
+        return count;
+      },
+      [=](Index i0, Index i1, Index pos, bool) {
+        for (Index i = i0; i < i1; ++i) {
+          if (keep(i)) {
+            emit(i, pos);
+            ++pos;
+          }
+        }
+        return pos;
+      });
+}
+
+/*!
+        \brief stable partition of [0, n) by keep; returns the number kept
+
+        Rejected indices are placed after all kept ones, so the total has to
+        be known first: each thread counts the kept indices of its chunks,
+        the per-chunk counts are scanned, and the same threads then scatter
+        the chunks they counted.
+*/
+template <typename Policy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_openmp_policy<Policy>::value,
+                        Index>::type
+partition(const Policy&, Index n, Keep keep, Emit emit)
+{
+  const Index chunk = detail::compact_chunk;
+  const Index num_chunks = (n + chunk - 1) / chunk;
+  ::std::vector<Index> kept(num_chunks + 1);
+
+#pragma omp parallel
+  {
+#pragma omp for schedule(static)
+    for (Index c = 0; c < num_chunks; ++c) {
+      const Index i1 = ::std::min(n, (c + 1) * chunk);
+      Index count = 0;
+      for (Index i = c * chunk; i < i1; ++i) {
+        count += keep(i) ? 1 : 0;
+      }
+      kept[c + 1] = count;
+    }
+
+#pragma omp single
+    {
+      for (Index c = 0; c < num_chunks; ++c) {
+        kept[c + 1] += kept[c];
+      }
+    }
+
+    const Index total = kept[num_chunks];
+
+#pragma omp for schedule(static)
+    for (Index c = 0; c < num_chunks; ++c) {
+      const Index i1 = ::std::min(n, (c + 1) * chunk);
+      Index count = kept[c];
+      for (Index i = c * chunk; i < i1; ++i) {
+        if (keep(i)) {
+          emit(i, count);
+          ++count;
+        } else {
+          emit(i, total + (i - count));
+        }
+      }
+    }
+  }
+
+  return kept[num_chunks];
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -34,12 +34,16 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <iostream>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -47,6 +51,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -69,8 +74,19 @@ RAJA_INLINE void forall_impl(const omp_parallel_exec<InnerPolicy>&,
                              Func&& loop_body)
 {
 
+  using RAJA::internal::thread_privatize;
+
+  // inside an omp_fused_region, share its team; InnerPolicy ends with a
+  // barrier, as the end of a parallel region would. Loops nested in the
+  // body are not shared by the team, so they fork their own region.
+  if (detail::inOMPFusedRegion()) {
+    auto body = thread_privatize(loop_body);
+    detail::OMPFusedRegionScope nested(false);
+    forall_impl(InnerPolicy{}, iter, body.get_priv());
+    return;
+  }
+
   RAJA::region<RAJA::omp_parallel_region>([&]() {
-    using RAJA::internal::thread_privatize;
     auto body = thread_privatize(loop_body);
     forall_impl(InnerPolicy{}, iter, body.get_priv());
   });
@@ -112,7 +128,7 @@ RAJA_INLINE void forall_impl(const omp_for_exec&,
 /// OpenMP parallel for static policy implementation
 ///
 
-template <typename Iterable, typename Func, size_t ChunkSize>
+template <typename Iterable, typename Func, unsigned int ChunkSize>
 RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
                              Iterable&& iter,
                              Func&& loop_body)
@@ -124,6 +140,87 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+///
+/// OpenMP for dynamic, guided and runtime schedule policy implementations
+///
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_dynamic<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(dynamic, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_guided<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(guided, ChunkSize)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_runtime&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+#pragma omp for schedule(runtime)
+  for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    loop_body(begin_it[i]);
+  }
+}
+
+///
+/// OpenMP for policy implementation with a stable static partition
+///
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_stable<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using Index = decltype(distance_it);
+  RAJA::detail::forEachStaticBlock(distance_it,
+                                   Index(ChunkSize),
+                                   omp_get_thread_num(),
+                                   omp_get_num_threads(),
+                                   [&](Index begin, Index end) {
+                                     for (Index i = begin; i < end; ++i) {
+                                       loop_body(begin_it[i]);
+                                     }
+                                   });
+#pragma omp barrier
+}
+
+template <typename Iterable, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_stable_nowait<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using Index = decltype(distance_it);
+  RAJA::detail::forEachStaticBlock(distance_it,
+                                   Index(ChunkSize),
+                                   omp_get_thread_num(),
+                                   omp_get_num_threads(),
+                                   [&](Index begin, Index end) {
+                                     for (Index i = begin; i < end; ++i) {
+                                       loop_body(begin_it[i]);
+                                     }
+                                   });
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -134,67 +231,195 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace detail
+{
+
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Run task of a dependency graph and whatever it makes ready.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         After a task runs, it is reset for the next execution of the graph
+ *         and its successors are notified. The first successor that becomes
+ *         ready is continued on this thread; any other ready successor is
+ *         spawned as an OpenMP task that idle threads pick up.
  *
  ******************************************************************************
  */
+template <typename Runner>
+void run_dep_graph_task(DepGraph* graph, int task, Runner* runner)
+{
+  while (task >= 0) {
+    (*runner)(task);
+
+    DepGraphNode& node = (*graph)[task];
+    node.reset();
+
+    int next = -1;
+    for (int ii = 0; ii < node.numDepTasks(); ++ii) {
+      int dep = node.depTaskNum(ii);
+      if ((*graph)[dep].satisfyOne()) {
+        if (next < 0) {
+          next = dep;
+        } else {
+#pragma omp task firstprivate(graph, dep, runner)
+          run_dep_graph_task(graph, dep, runner);
+        }
+      }
+    }
+    task = next;
+  }
+}
 
-/*
- * TODO: Fix this!!!
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute all tasks of a finalized dependency graph in an OpenMP
+ *         parallel region; run_task(body, task) executes one task using a
+ *         copy of loop_body private to the executing thread.
+ *
+ ******************************************************************************
  */
+template <typename Func, typename RunTask>
+RAJA_INLINE void execute_dep_graph(DepGraph& graph,
+                                   Func&& loop_body,
+                                   RunTask run_task)
+{
+  using RAJA::internal::thread_privatize;
+  using Priv = decltype(thread_privatize(loop_body));
+
+  std::vector<Priv*> bodies(omp_get_max_threads());
+  Priv** priv = bodies.data();
+  DepGraph* g = &graph;
+
+  auto runner = [=](int task) {
+    run_task(priv[omp_get_thread_num()]->get_priv(), task);
+  };
+
+#pragma omp parallel
+  {
+    auto body = thread_privatize(loop_body);
+    priv[omp_get_thread_num()] = &body;
+
+    // every thread's copy must exist before any task can run
+#pragma omp barrier
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+#pragma omp single
+    {
+      for (int root : g->roots()) {
+#pragma omp task firstprivate(root)
+        run_dep_graph_task(g, root, &runner);
+      }
+    }
+  }
+}
+
+RAJA_INLINE void check_dep_graph(bool graph_set)
 {
-  if (!iset.dependencyGraphSet()) {
+  if (!graph_set) {
     std::cerr << "\n RAJA IndexSet dependency graph not set , "
               << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
     RAJA_ABORT_OR_THROW("IndexSet dependency graph");
   }
+}
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
-
-  int num_seg = ncis.getNumSegments();
-
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
-
-    task->wait();
+}  // namespace detail
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in dependency graph order. Each
+ *         segment becomes an OpenMP task once all of its predecessors have
+ *         completed; individual segment execution will use the segment
+ *         execution policy template parameter.
+ *
+ *         This method assumes that a task dependency graph has been
+ *         set up and finalized for the index set, one node per segment.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  detail::check_dep_graph(iset.dependencyGraphSet());
 
-    task->reset();
+  detail::execute_dep_graph(iset.getDependencyGraph(),
+                            loop_body,
+                            [](decltype(loop_body) body, int seg) {
+                              body(seg);
+                            });
+}
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
-    }
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over intervals of index set segments in dependency graph
+ *         order; node i of the graph executes, in order, the segments of
+ *         the interval i set with setSegmentInterval().
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_interval_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  detail::check_dep_graph(iset.dependencyGraphSet());
+
+  const TypedIndexSet<SegmentTypes...>* is = &iset;
+  detail::execute_dep_graph(
+      iset.getDependencyGraph(),
+      loop_body,
+      [=](decltype(loop_body) body, int interval) {
+        const int end = is->getSegmentIntervalEnd(interval);
+        for (int seg = is->getSegmentIntervalBegin(interval); seg < end;
+             ++seg) {
+          body(seg);
+        }
+      });
+}
 
-  }  // iterate over segments of index set
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in parts of about equal cost, one
+ *         part per thread; long segments are split and short ones grouped.
+ *         Pieces of segments are executed with the segment execution
+ *         policy, and forall_Icount passes the index set icount of each.
+ *
+ *         The partition is cached on the index set, so loops after the
+ *         first one with the same number of threads do not build it again.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_balanced_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  // in an omp_fused_region every thread of the team gets here, so one
+  // of them builds the partition
+  std::shared_ptr<const SegmentPartition> owner;
+  if (RAJA::detail::inOMPFusedRegion()) {
+#pragma omp single copyprivate(owner)
+    owner = iset.getSegmentPartition(omp_get_num_threads());
+  } else {
+    owner = iset.getSegmentPartition(omp_get_max_threads());
+  }
+  const SegmentPartition* partition = owner.get();
+
+  forall_impl(omp_parallel_for_static<1>{},
+              RangeSegment(0, partition->getNumParts()),
+              [=](int part) {
+                for (const SegmentPiece* piece = partition->partBegin(part);
+                     piece != partition->partEnd(part);
+                     ++piece) {
+                  loop_body(piece->segment, piece->begin, piece->end);
+                }
+              });
 }
-*/
 
 }  // namespace omp
 
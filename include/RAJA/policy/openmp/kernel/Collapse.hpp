@@ -30,8 +30,10 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
-#include <cassert>
-#include <climits>
+#include <algorithm>
+#include <type_traits>
+
+#include <omp.h>
 
 #include "RAJA/pattern/detail/privatizer.hpp"
 
@@ -42,15 +44,10 @@
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/region.hpp"
 
 #include "RAJA/internal/LegacyCompatibility.hpp"
 
-#if !defined(RAJA_COMPILER_MSVC)
-#define RAJA_COLLAPSE(X) collapse(X)
-#else
-#define RAJA_COLLAPSE(X)
-#endif
-
 namespace RAJA
 {
 
@@ -60,89 +57,251 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+///
+/// Collapse policies that hand out chunks of N iterations of the collapsed
+/// loops with schedule(static, N) and schedule(dynamic, N).
+///
+template <unsigned int N>
+struct omp_parallel_collapse_static
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            RAJA::policy::omp::Static<N>> {
+  static_assert(N > 0, "chunk size must be positive");
+};
+
+template <unsigned int N>
+struct omp_parallel_collapse_dynamic
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            RAJA::policy::omp::Dynamic<N>> {
+  static_assert(N > 0, "chunk size must be positive");
+};
+
 namespace internal
 {
 
-/////////
-// Collapsing two loops
-/////////
-
-template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1>,
-                                             EnclosedStmts...>> {
+/*!
+ * Indices of the collapsed loops for one thread, as an odometer over the
+ * loop lengths. Moving to the start of a chunk of the linearized loop takes
+ * one division per loop; moving along it only increments the indices.
+ */
+template <size_t Depth>
+class OmpCollapseIndex
+{
+public:
+  explicit OmpCollapseIndex(Index_type const (&lengths)[Depth])
+  {
+    for (size_t d = 0; d < Depth; ++d) {
+      m_length[d] = lengths[d];
+    }
+  }
 
+  //! move to iteration i of the linearized loop
+  RAJA_INLINE void seek(Index_type i)
+  {
+    if (i != m_pos) {
+      m_pos = i;
+      for (size_t d = Depth; d-- > 0;) {
+        m_index[d] = i % m_length[d];
+        i /= m_length[d];
+      }
+    }
+  }
 
-  template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
+  //! iterations left in the innermost loop, including the current one
+  RAJA_INLINE Index_type inner_left() const
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    // NOTE: these are here to avoid a use-after-scope detected by address
-    // sanitizer, probably a false positive, but the result should be
-    // essentially identical
-    auto i0 = l0;
-    auto i1 = l1;
+    return m_length[Depth - 1] - m_index[Depth - 1];
+  }
 
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
-    RAJA_COLLAPSE(2)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        auto& private_data = privatizer.get_priv();
-        private_data.template assign_offset<Arg0>(i0);
-        private_data.template assign_offset<Arg1>(i1);
-        execute_statement_list<camp::list<EnclosedStmts...>>(private_data);
-      }
+  //! move n iterations ahead, at most to the end of the innermost loop
+  RAJA_INLINE void advance(Index_type n)
+  {
+    m_pos += n;
+    m_index[Depth - 1] += n;
+    for (size_t d = Depth - 1; d > 0 && m_index[d] == m_length[d]; --d) {
+      m_index[d] = 0;
+      ++m_index[d - 1];
     }
   }
+
+  RAJA_INLINE Index_type operator[](size_t d) const { return m_index[d]; }
+
+private:
+  Index_type m_length[Depth];
+  Index_type m_index[Depth] = {};
+  Index_type m_pos = 0;
 };
 
+//
+// Split the linearized loop of length len into chunks and call
+// body(begin, end) for each chunk of this thread.
+//
 
-template <camp::idx_t Arg0,
-          camp::idx_t Arg1,
-          camp::idx_t Arg2,
-          typename... EnclosedStmts>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1, Arg2>,
-                                             EnclosedStmts...>> {
+template <typename Func>
+RAJA_INLINE void omp_collapse_for(omp_parallel_collapse_exec const &,
+                                  Index_type len,
+                                  Func &&body)
+{
+  // one contiguous chunk per thread, as schedule(static)
+  const Index_type chunks = omp_get_num_threads();
+#pragma omp for schedule(static)
+  for (Index_type c = 0; c < chunks; ++c) {
+    body(c * len / chunks, (c + 1) * len / chunks);
+  }
+}
 
+template <unsigned int N, typename Func>
+RAJA_INLINE void omp_collapse_for(omp_parallel_collapse_static<N> const &,
+                                  Index_type len,
+                                  Func &&body)
+{
+  const Index_type chunks = (len + N - 1) / N;
+#pragma omp for schedule(static, 1)
+  for (Index_type c = 0; c < chunks; ++c) {
+    body(c * N, std::min<Index_type>(len, (c + 1) * N));
+  }
+}
+
+template <unsigned int N, typename Func>
+RAJA_INLINE void omp_collapse_for(omp_parallel_collapse_dynamic<N> const &,
+                                  Index_type len,
+                                  Func &&body)
+{
+  const Index_type chunks = (len + N - 1) / N;
+#pragma omp for schedule(dynamic, 1)
+  for (Index_type c = 0; c < chunks; ++c) {
+    body(c * N, std::min<Index_type>(len, (c + 1) * N));
+  }
+}
+
+template <camp::idx_t First, camp::idx_t... Rest>
+struct OmpCollapseLastArg : OmpCollapseLastArg<Rest...> {
+};
+
+template <camp::idx_t Last>
+struct OmpCollapseLastArg<Last> : std::integral_constant<camp::idx_t, Last> {
+};
 
+
+/////////
+// Collapsing any number of loops into one OpenMP loop
+/////////
+
+template <typename ExecPolicy, typename ArgListT, typename... EnclosedStmts>
+struct OmpCollapseExecutor;
+
+template <typename ExecPolicy, camp::idx_t... Args, typename... EnclosedStmts>
+struct OmpCollapseExecutor<ExecPolicy, ArgList<Args...>, EnclosedStmts...> {
+
+  static constexpr size_t depth = sizeof...(Args);
+  static constexpr camp::idx_t inner = OmpCollapseLastArg<Args...>::value;
+
+  template <typename Data, camp::idx_t... Ds>
+  static RAJA_INLINE void assign(Data &data,
+                                 OmpCollapseIndex<depth> const &index,
+                                 camp::idx_seq<Ds...>)
+  {
+    camp::sink((data.template assign_offset<Args>(index[Ds]), 0)...);
+  }
+
+  // runs iterations [begin, end) of the linearized loop, the innermost loop
+  // in runs with the outer indices fixed
   template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
+  static RAJA_INLINE void exec_chunk(Data &data,
+                                     OmpCollapseIndex<depth> &index,
+                                     Index_type begin,
+                                     Index_type end)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    const auto l2 = segment_length<Arg2>(data);
-    auto i0 = l0;
-    auto i1 = l1;
-    auto i2 = l2;
+    index.seek(begin);
+    while (begin < end) {
+      const Index_type run = std::min(end - begin, index.inner_left());
+      const Index_type first = index[depth - 1];
+      assign(data, index, camp::make_idx_seq_t<depth>{});
+      for (Index_type i = 0; i < run; ++i) {
+        data.template assign_offset<inner>(first + i);
+        execute_statement_list<camp::list<EnclosedStmts...>>(data);
+      }
+      index.advance(run);
+      begin += run;
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    const Index_type lengths[depth] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+    Index_type len = 1;
+    for (size_t d = 0; d < depth; ++d) {
+      len *= lengths[d];
+    }
+    if (len <= 0) return;
 
     using RAJA::internal::thread_privatize;
+
+    // inside an omp_fused_region, share its team; the omp for ends with a
+    // barrier, as the end of a parallel region would
+    if (RAJA::detail::inOMPFusedRegion()) {
+      auto privatizer = thread_privatize(data);
+      RAJA::detail::OMPFusedRegionScope nested(false);
+      auto &private_data = privatizer.get_priv();
+      OmpCollapseIndex<depth> index(lengths);
+      omp_collapse_for(ExecPolicy{},
+                       len,
+                       [&](Index_type begin, Index_type end) {
+                         exec_chunk(private_data, index, begin, end);
+                       });
+      return;
+    }
+
     auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
-    RAJA_COLLAPSE(3)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        for (i2 = 0; i2 < l2; ++i2) {
-          auto& private_data = privatizer.get_priv();
-          private_data.template assign_offset<Arg0>(i0);
-          private_data.template assign_offset<Arg1>(i1);
-          private_data.template assign_offset<Arg2>(i2);
-          execute_statement_list<camp::list<EnclosedStmts...>>(private_data);
-        }
-      }
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto &private_data = privatizer.get_priv();
+      OmpCollapseIndex<depth> index(lengths);
+      omp_collapse_for(ExecPolicy{},
+                       len,
+                       [&](Index_type begin, Index_type end) {
+                         exec_chunk(private_data, index, begin, end);
+                       });
     }
   }
 };
 
+template <typename ArgListT, typename... EnclosedStmts>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
+                                             ArgListT,
+                                             EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_exec,
+                          ArgListT,
+                          EnclosedStmts...> {
+};
+
+template <unsigned int N, typename ArgListT, typename... EnclosedStmts>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_static<N>,
+                                             ArgListT,
+                                             EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_static<N>,
+                          ArgListT,
+                          EnclosedStmts...> {
+};
+
+template <unsigned int N, typename ArgListT, typename... EnclosedStmts>
+struct StatementExecutor<statement::Collapse<omp_parallel_collapse_dynamic<N>,
+                                             ArgListT,
+                                             EnclosedStmts...>>
+    : OmpCollapseExecutor<omp_parallel_collapse_dynamic<N>,
+                          ArgListT,
+                          EnclosedStmts...> {
+};
+
 
 }  // namespace internal
 }  // namespace RAJA
 
-#undef RAJA_COLLAPSE
-
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,73 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA multi-reduction templates for
+ *          OpenMP execution.
+ *
+ *          These methods should work on any platform that supports OpenMP.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_omp_multi_reduce_HPP
+#define RAJA_omp_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/util/mutex.hpp"
+
+#include "RAJA/pattern/detail/multi_reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! one row of bins per OpenMP thread; thread ids repeat across the teams
+//! of nested parallel regions, so copies made there get no shared row
+struct MultiReduceOMPThreads {
+  using mutex_type = omp::mutex;
+  static int max_threads() { return omp_get_max_threads(); }
+  static int thread_num()
+  {
+    return omp_get_level() <= 1 ? omp_get_thread_num() : -1;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_MULTI_REDUCERS(omp_reduce, detail::MultiReduceOMPThreads)
+
+RAJA_DECLARE_ALL_MULTI_REDUCERS(omp_reduce_ordered,
+                                detail::MultiReduceOMPThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
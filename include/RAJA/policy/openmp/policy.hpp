@@ -54,6 +54,21 @@ template <unsigned int ChunkSize>
 struct Static : std::integral_constant<unsigned int, ChunkSize> {
 };
 
+template <unsigned int ChunkSize>
+struct Dynamic : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+template <unsigned int ChunkSize>
+struct Guided : std::integral_constant<unsigned int, ChunkSize> {
+};
+
+struct Runtime {
+};
+
+template <unsigned int ChunkSize>
+struct Stable : std::integral_constant<unsigned int, ChunkSize> {
+};
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 
 template <unsigned int TeamSize>
@@ -83,6 +98,18 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+/// Parallel region whose team is reused by the omp_parallel_exec loops
+/// (e.g. omp_parallel_for_exec) run inside it, instead of each loop
+/// forking its own team.
+///
+struct omp_fused_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 struct omp_for_exec
     : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::For> {
 };
@@ -105,6 +132,74 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+///
+/// Loops whose iterations differ in cost: threads take chunks of N
+/// iterations as they finish earlier ones (schedule(dynamic, N)), or chunks
+/// that shrink from a share of the remaining iterations down to N
+/// (schedule(guided, N)).
+///
+template <unsigned int N = 1>
+struct omp_for_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_for_guided : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::For,
+                                                              omp::Guided<N>> {
+};
+
+///
+/// Schedule chosen at run time with OMP_SCHEDULE or omp_set_schedule()
+/// (schedule(runtime)).
+///
+struct omp_for_runtime : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                               Pattern::forall,
+                                                               Launch::undefined,
+                                                               Platform::host,
+                                                               omp::For,
+                                                               omp::Runtime> {
+};
+
+///
+/// Static partition computed by RAJA rather than the OpenMP runtime, so
+/// every call with the same length and team size hands each thread the
+/// same iterations (see detail::forEachStaticBlock). N == 0 gives each
+/// thread one contiguous block.
+///
+template <unsigned int N = 0>
+struct omp_for_stable : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::For,
+                                                              omp::Stable<N>> {
+};
+
+///
+/// Same partition as omp_for_stable, without the barrier after the loop.
+/// Loops of equal length in one region give each thread the same
+/// iterations, so a loop that only reads what an earlier one wrote at the
+/// same index needs no barrier in between.
+///
+template <unsigned int N = 0>
+struct omp_for_stable_nowait
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For,
+                                            omp::Stable<N>,
+                                            omp::NoWait> {
+};
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -123,6 +218,21 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+template <unsigned int N = 0>
+struct omp_parallel_for_stable : omp_parallel_exec<omp_for_stable<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_parallel_for_dynamic : omp_parallel_exec<omp_for_dynamic<N>> {
+};
+
+template <unsigned int N = 1>
+struct omp_parallel_for_guided : omp_parallel_exec<omp_for_guided<N>> {
+};
+
+struct omp_parallel_for_runtime : omp_parallel_exec<omp_for_runtime> {
+};
+
 ///
 /// Policies for applying OpenMP clauses in forallN loop nests.
 ///
@@ -168,6 +278,10 @@ struct omp_taskgraph_interval_segit
     : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
 };
 
+struct omp_balanced_segit
+    : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::Parallel> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -198,18 +312,32 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 }  // namespace omp
 }  // namespace policy
 
+using policy::omp::omp_balanced_segit;
 using policy::omp::omp_collapse_nowait_exec;
+using policy::omp::omp_fused_region;
+using policy::omp::omp_for_dynamic;
 using policy::omp::omp_for_exec;
+using policy::omp::omp_for_guided;
 using policy::omp::omp_for_nowait_exec;
+using policy::omp::omp_for_runtime;
+using policy::omp::omp_for_stable;
+using policy::omp::omp_for_stable_nowait;
 using policy::omp::omp_for_static;
 using policy::omp::omp_parallel_exec;
+using policy::omp::omp_parallel_for_dynamic;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_guided;
+using policy::omp::omp_parallel_for_runtime;
+using policy::omp::omp_parallel_for_stable;
+using policy::omp::omp_parallel_for_static;
 using policy::omp::omp_parallel_for_segit;
 using policy::omp::omp_parallel_region;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_taskgraph_interval_segit;
+using policy::omp::omp_taskgraph_segit;
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using policy::omp::omp_target_parallel_for_exec;
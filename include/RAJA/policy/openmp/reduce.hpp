@@ -34,12 +34,14 @@
 #if defined(RAJA_ENABLE_OPENMP)
 
 #include <memory>
-#include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
@@ -51,24 +53,139 @@ namespace RAJA
 
 namespace detail
 {
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Partial results shared by an OpenMP reducer and all of its copies.
+ *
+ *         Each thread folds into its own cache-line-padded slot, so no lock
+ *         is taken when thread copies are destroyed. Threads whose id is
+ *         beyond the slots allocated at construction (e.g., the thread count
+ *         was raised afterwards), or that run in a nested parallel region,
+ *         where ids repeat across teams, fall back to a locked spill value.
+ *
+ ******************************************************************************
+ */
 template <typename T, typename Reduce>
-class ReduceOMP
-    : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
+class OMPReduceData
 {
-  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
+public:
+  explicit OMPReduceData(T identity_)
+      : slots(omp_get_max_threads(), identity_), spill(identity_)
+  {
+  }
+
+  void combine(T const& val)
+  {
+    // thread ids are only unique outside nested parallel regions
+    int tid = omp_get_thread_num();
+    if (omp_get_level() <= 1 && tid < slots.size()) {
+      Reduce{}(slots[tid], val);
+    } else {
+      lock_guard<omp::mutex> lock(spill_lock);
+      Reduce{}(spill, val);
+    }
+  }
+
+  //! fold slots into res one at a time, in thread order
+  void fold_ordered(T& res) const
+  {
+    for (int i = 0; i < slots.size(); ++i) {
+      Reduce{}(res, slots[i]);
+    }
+    Reduce{}(res, spill);
+  }
+
+  //! fold slots into res pairwise, as a balanced tree
+  void fold_tree(T& res) const
+  {
+    Reduce{}(res, fold_tree(0, slots.size()));
+    Reduce{}(res, spill);
+  }
+
+private:
+  T fold_tree(int begin, int end) const
+  {
+    if (end - begin == 1) {
+      return slots[begin];
+    }
+    int mid = begin + (end - begin) / 2;
+    T val = fold_tree(begin, mid);
+    Reduce{}(val, fold_tree(mid, end));
+    return val;
+  }
+
+  ThreadSlots<T> slots;
+  T spill;
+  omp::mutex spill_lock;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Combinable base for OpenMP reducers; copies of the reducer fold
+ *         their values into OMPReduceData when destroyed.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce, typename Derived>
+class OMPSlotCombinable
+    : public reduce::detail::BaseCombinable<T, Reduce, Derived>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, Derived>;
+
+protected:
+  std::shared_ptr<OMPReduceData<T, Reduce>> data;
+
+  //! value held by the original reducer object, if this is a copy
+  T root_value() const
+  {
+    return Base::parent ? Base::parent->local() : Base::my_data;
+  }
+
+  //! fold any pending value held by this copy
+  void fold_pending(T& res) const
+  {
+    if (Base::parent) {
+      Reduce{}(res, Base::my_data);
+    }
+  }
+
+public:
+  OMPSlotCombinable(T init_val, T identity_) { reset(init_val, identity_); }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    data = std::make_shared<OMPReduceData<T, Reduce>>(identity_);
+  }
+
+  ~OMPSlotCombinable()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+      data->combine(Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+};
+
+template <typename T, typename Reduce>
+class ReduceOMP : public OMPSlotCombinable<T, Reduce, ReduceOMP<T, Reduce>>
+{
+  using Base = OMPSlotCombinable<T, Reduce, ReduceOMP>;
 
 public:
   using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
-  ~ReduceOMP()
+  T get_combined() const
   {
-    if (Base::parent) {
-#pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
-      Base::my_data = Base::identity;
-    }
+    T res = Base::root_value();
+    Base::data->fold_tree(res);
+    Base::fold_pending(res);
+    return res;
   }
 };
 
@@ -84,47 +201,32 @@ RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
 namespace detail
 {
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Ordered OpenMP reducer; thread partials are folded strictly in
+ *         thread order, so results are bitwise reproducible for a fixed
+ *         thread count and static schedule.
+ *
+ ******************************************************************************
+ */
 template <typename T, typename Reduce>
 class ReduceOMPOrdered
-    : public reduce::detail::
-          BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
+    : public OMPSlotCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
-  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  using Base = OMPSlotCombinable<T, Reduce, ReduceOMPOrdered>;
 
 public:
-  ReduceOMPOrdered() { reset(T(), T()); }
-
-  //! constructor requires a default value for the reducer
-  explicit ReduceOMPOrdered(T init_val, T identity_)
-  {
-    reset(init_val, identity_);
-  }
-
-  void reset(T init_val, T identity_)
-  {
-    Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
-  }
+  using Base::Base;
 
-  ~ReduceOMPOrdered()
-  {
-    Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-    Base::my_data = Base::identity;
-  }
+  ReduceOMPOrdered() : Base(T(), T()) {}
 
   T get_combined() const
   {
-    if (Base::my_data != Base::identity) {
-      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-      Base::my_data = Base::identity;
-    }
-
-    T res = Base::identity;
-    for (size_t i = 0; i < data->size(); ++i) {
-      Reduce{}(res, (*data)[i]);
-    }
+    T res = Base::root_value();
+    Base::data->fold_ordered(res);
+    Base::fold_pending(res);
     return res;
   }
 };
@@ -16,8 +16,45 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include "RAJA/config.hpp"
+
+#include <omp.h>
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
+
+namespace detail
+{
+
+//! true on the threads of an omp_fused_region's team, while it runs
+RAJA_INLINE bool &ompFusedRegionFlag()
+{
+  static thread_local bool in_region = false;
+  return in_region;
+}
+
+RAJA_INLINE bool inOMPFusedRegion() { return ompFusedRegionFlag(); }
+
+//! marks the calling thread as part of a fused region, or not, while alive
+class OMPFusedRegionScope
+{
+public:
+  explicit OMPFusedRegionScope(bool in_region = true)
+      : m_outer(ompFusedRegionFlag())
+  {
+    ompFusedRegionFlag() = in_region;
+  }
+  ~OMPFusedRegionScope() { ompFusedRegionFlag() = m_outer; }
+
+private:
+  bool m_outer;
+};
+
+}  // namespace detail
+
 namespace policy
 {
 namespace omp
@@ -52,6 +89,59 @@ RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
     }
 }
 
+/*!
+ * \brief RAJA::region implementation for a fused OpenMP region.
+ *
+ * Opens one parallel region for a sequence of loops. Loops run with
+ * omp_parallel_exec policies (e.g. omp_parallel_for_exec), directly or in
+ * RAJA::kernel For statements, share the region's team instead of forking
+ * their own, and keep the barrier at their end. Loops run with nowait
+ * policies (omp_for_nowait_exec, omp_for_stable_nowait) have no barrier;
+ * declare dependencies between them with RAJA::region_sync.
+ *
+ * \code
+ *
+ * RAJA::region<omp_fused_region>([=](){
+ *
+ *   RAJA::forall<omp_for_stable_nowait<>>(zones, [=](int i) { a[i] = ...; });
+ *   RAJA::forall<omp_for_stable_nowait<>>(zones, [=](int i) { b[i] = a[i]; });
+ *
+ *   // next loop reads a[i - 1]
+ *   RAJA::region_sync<omp_fused_region>();
+ *
+ *   RAJA::forall<omp_parallel_for_exec>(zones, [=](int i) {
+ *     dt.min(a[i] - a[i - 1]);
+ *   });
+ *
+ *   double step = RAJA::region_get<omp_fused_region>(dt);
+ *   ...
+ *
+ *  });
+ *
+ * \endcode
+ *
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_fused_region &, Func &&body)
+{
+#pragma omp parallel
+  {
+    RAJA::detail::OMPFusedRegionScope scope;
+    body();
+  }
+}
+
+//! barrier for the team of an OpenMP region
+RAJA_INLINE void region_sync_impl(const omp_parallel_region &)
+{
+#pragma omp barrier
+}
+
+RAJA_INLINE void region_sync_impl(const omp_fused_region &)
+{
+#pragma omp barrier
+}
+
 }  // namespace omp
 
 }  // namespace policy
@@ -29,8 +29,11 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -46,12 +49,177 @@ namespace impl
 namespace scan
 {
 
-RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+namespace detail
 {
-  return (static_cast<size_t>(n) * pid) / p;
+
+//! approximate number of bytes in one chunk of the single-pass scan; a chunk
+//! is read once from memory and then again from cache
+const int scan_chunk_bytes = 64 * 1024;
+
+//! lookback state of one chunk of the single-pass scan
+enum ScanChunkStatus { scan_invalid = 0, scan_aggregate, scan_prefix };
+
+/*!
+        \brief scan [begin + i0, begin + i1) into out starting from prefix
+   pre; an inclusive scan without a prefix starts from the first element.
+   Returns the inclusive prefix of the last element.
+*/
+template <typename Iter,
+          typename OutIter,
+          typename Index,
+          typename BinFn,
+          typename Value>
+RAJA_INLINE Value scan_block(Iter begin,
+                             OutIter out,
+                             Index i0,
+                             Index i1,
+                             BinFn f,
+                             bool exclusive,
+                             Value pre,
+                             bool has_pre)
+{
+  if (exclusive) {
+    for (Index i = i0; i < i1; ++i) {
+      auto t = *(begin + i);
+      *(out + i) = pre;
+      pre = f(pre, t);
+    }
+  } else {
+    Index i = i0;
+    if (!has_pre) {
+      pre = *(begin + i);
+      *(out + i) = pre;
+      ++i;
+    }
+    for (; i < i1; ++i) {
+      pre = f(pre, *(begin + i));
+      *(out + i) = pre;
+    }
+  }
+  return pre;
+}
+
+/*!
+        \brief single-pass chunked scan of [0, n) using decoupled lookback
+
+        Chunks are claimed in increasing order from a shared ticket. Each
+        chunk computes its aggregate with reduce(i0, i1), publishes it, and
+        then looks back over preceding chunks until it finds one with a
+        published inclusive prefix. Once its own prefix is published, the
+        chunk calls finish(i0, i1, pre, has_pre) with its exclusive prefix,
+        so finish may write output for the chunk while its input is still
+        in cache. Returns the inclusive prefix of the whole range.
+*/
+template <typename Index,
+          typename Value,
+          typename BinFn,
+          typename Reduce,
+          typename Finish>
+Value lookback_scan(Index n,
+                    Index chunk,
+                    BinFn f,
+                    Value init,
+                    bool has_init,
+                    Reduce reduce,
+                    Finish finish)
+{
+  const Index num_chunks = (n + chunk - 1) / chunk;
+  const int p = static_cast<int>(
+      ::std::min<Index>(num_chunks, omp_get_max_threads()));
+
+  if (p == 1) {
+    return finish(Index(0), n, init, has_init);
+  }
+
+  ::std::vector<Value> aggregate(num_chunks);
+  ::std::vector<Value> prefix(num_chunks);
+  ::std::unique_ptr<::std::atomic<int>[]> status(
+      new ::std::atomic<int>[num_chunks]);
+  for (Index c = 0; c < num_chunks; ++c) {
+    status[c].store(scan_invalid, ::std::memory_order_relaxed);
+  }
+  ::std::atomic<Index> ticket(0);
+
+#pragma omp parallel num_threads(p)
+  {
+    for (Index c = ticket++; c < num_chunks; c = ticket++) {
+      const Index i0 = c * chunk;
+      const Index i1 = ::std::min(n, i0 + chunk);
+
+      const Value agg = reduce(i0, i1);
+
+      // exclusive prefix of this chunk; there is none for c == 0 unless an
+      // initial value was given
+      Value pre = init;
+      bool has_pre = has_init;
+      if (c == 0) {
+        prefix[c] = has_pre ? f(pre, agg) : agg;
+        status[c].store(scan_prefix, ::std::memory_order_release);
+      } else {
+        aggregate[c] = agg;
+        status[c].store(scan_aggregate, ::std::memory_order_release);
+
+        has_pre = false;
+        for (Index j = c - 1;; --j) {
+          int s;
+          while ((s = status[j].load(::std::memory_order_acquire))
+                 == scan_invalid) {
+            ::std::this_thread::yield();
+          }
+          const Value& v = (s == scan_prefix) ? prefix[j] : aggregate[j];
+          pre = has_pre ? f(v, pre) : v;
+          has_pre = true;
+          if (s == scan_prefix) break;
+        }
+
+        prefix[c] = f(pre, agg);
+        status[c].store(scan_prefix, ::std::memory_order_release);
+      }
+
+      finish(i0, i1, pre, has_pre);
+    }
+  }
+
+  return prefix[num_chunks - 1];
+}
+
+/*!
+        \brief single-pass scan of [begin, end) into out; begin and out may
+   alias. Each element is read from memory and written exactly once.
+*/
+template <typename Iter, typename OutIter, typename BinFn, typename Value>
+void single_pass(Iter begin,
+                 Iter end,
+                 OutIter out,
+                 BinFn f,
+                 bool exclusive,
+                 Value init)
+{
+  using Index = typename ::std::iterator_traits<Iter>::difference_type;
+  const Index n = end - begin;
+  const Index chunk = ::std::max<Index>(
+      1024, scan_chunk_bytes / static_cast<Index>(sizeof(Value)));
+
+  lookback_scan(n,
+                chunk,
+                f,
+                init,
+                exclusive,
+                [=](Index i0, Index i1) {
+                  Value agg = *(begin + i0);
+                  for (Index i = i0 + 1; i < i1; ++i) {
+                    agg = f(agg, *(begin + i));
+                  }
+                  return agg;
+                },
+                [=](Index i0, Index i1, Value pre, bool has_pre) {
+                  return scan_block(
+                      begin, out, i0, i1, f, exclusive, pre, has_pre);
+                });
 }
 
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -64,25 +232,8 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::seq_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  if (end - begin <= 0) return;
+  detail::single_pass(begin, end, begin, f, false, Value());
 }
 
 /*!
@@ -98,27 +249,8 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(seq_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  if (end - begin <= 0) return;
+  detail::single_pass(begin, end, begin, f, true, static_cast<Value>(v));
 }
 
 /*!
@@ -127,14 +259,15 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  if (end - begin <= 0) return;
+  detail::single_pass(begin, end, out, f, false, Value());
 }
 
 /*!
@@ -147,15 +280,16 @@ template <typename Policy,
           typename BinFn,
           typename ValueT>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  if (end - begin <= 0) return;
+  detail::single_pass(begin, end, out, f, true, static_cast<Value>(v));
 }
 
 }  // namespace scan
@@ -0,0 +1,138 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <omp.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+//! executor running the tasks of the shared sort algorithms in an OpenMP
+//! parallel region; consecutive tasks go to consecutive threads
+struct openmp_executor {
+  static int max_threads() { return omp_get_max_threads(); }
+
+  template <typename Body>
+  static void run(int num_tasks, Body body)
+  {
+#pragma omp parallel for schedule(static) if (num_tasks > 1)
+    for (int t = 0; t < num_tasks; ++t) {
+      body(t);
+    }
+  }
+};
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> unstable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sort<detail::openmp_executor, false>(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> stable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sort<detail::openmp_executor, true>(begin, end, comp);
+}
+
+/*!
+        \brief sort given key range and values using comparison function on
+   keys
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> unstable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sort_pairs<detail::openmp_executor, false>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given key range and values using comparison
+   function on keys
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> stable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sort_pairs<detail::openmp_executor, true>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
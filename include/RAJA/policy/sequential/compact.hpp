@@ -0,0 +1,106 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_sequential_HPP
+#define RAJA_compact_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+/*!
+        \brief emit every index in [0, n) for which keep holds at its rank
+   among the kept indices; returns the number kept
+*/
+template <typename ExecPolicy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_sequential_policy<ExecPolicy>::value,
+                        Index>::type
+select(const ExecPolicy &, Index n, Keep keep, Emit emit)
+{
+  Index count = 0;
+
+  RAJA_NO_SIMD
+  for (Index i = 0; i < n; ++i) {
+    if (keep(i)) {
+      emit(i, count);
+      ++count;
+    }
+  }
+  return count;
+}
+
+/*!
+        \brief stable partition of [0, n) by keep; returns the number kept
+
+        The kept count has to be known before the first rejected index can
+        be placed, so keep is evaluated in a counting pass and again while
+        scattering.
+*/
+template <typename ExecPolicy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_sequential_policy<ExecPolicy>::value,
+                        Index>::type
+partition(const ExecPolicy &, Index n, Keep keep, Emit emit)
+{
+  Index total = 0;
+
+  RAJA_NO_SIMD
+  for (Index i = 0; i < n; ++i) {
+    if (keep(i)) ++total;
+  }
+
+  Index count = 0;
+
+  RAJA_NO_SIMD
+  for (Index i = 0; i < n; ++i) {
+    if (keep(i)) {
+      emit(i, count);
+      ++count;
+    } else {
+      emit(i, total + (i - count));
+    }
+  }
+  return total;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
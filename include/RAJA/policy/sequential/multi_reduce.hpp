@@ -0,0 +1,58 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA multi-reduction templates for
+ *          sequential execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sequential_multi_reduce_HPP
+#define RAJA_sequential_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#include <mutex>
+
+#include "RAJA/pattern/detail/multi_reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! sequential execution uses a single row of bins
+struct MultiReduceSeqThreads {
+  using mutex_type = std::mutex;
+  static int max_threads() { return 1; }
+  static int thread_num() { return 0; }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_MULTI_REDUCERS(seq_reduce, detail::MultiReduceSeqThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -96,6 +96,11 @@ using policy::sequential::seq_segit;
 struct cpu_shmem {
 };
 
+//! Like cpu_shmem, but each worker thread (OpenMP or TBB) that privatizes
+//! the object gets its own buffer
+struct cpu_thread_shmem {
+};
+
 }  // namespace RAJA
 
 #endif
@@ -56,6 +56,16 @@ public:
   ReduceSeq() = delete;
 
   using Base::Base;
+
+  //! includes the value of the original object when called on a copy,
+  //! e.g. from inside a RAJA::region
+  T get_combined() const
+  {
+    if (!Base::parent) return Base::my_data;
+    T res = Base::parent->local();
+    Reduce{}(res, Base::my_data);
+    return res;
+  }
 };
 
 
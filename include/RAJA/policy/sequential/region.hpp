@@ -48,6 +48,8 @@ RAJA_INLINE void region_impl(const seq_region &, Func &&body)
   body();
 }
 
+RAJA_INLINE void region_sync_impl(const seq_region &) {}
+
 }  // namespace sequential
 
 }  // namespace policy
@@ -29,10 +29,24 @@
 #include "RAJA/config.hpp"
 
 #include <stddef.h>
+#include <algorithm>
 #include <memory>
+#include <new>
+#include <thread>
 #include <vector>
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/task_arena.h>
+#endif
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
 #include "RAJA/pattern/shared_memory.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
@@ -87,6 +101,174 @@ struct SharedMemory<cpu_shmem, T, NumElem> : public internal::SharedMemoryBase {
 };
 
 
+namespace detail
+{
+
+//! number of CPU worker threads that may privatize an object
+RAJA_INLINE int cpuWorkerCount()
+{
+  int count = getMaxOMPThreadsCPU();
+#if defined(RAJA_ENABLE_TBB)
+  count = std::max(count, ::tbb::this_task_arena::max_concurrency());
+#endif
+  return count;
+}
+
+//! id of the calling worker thread, in [0, cpuWorkerCount()), or -1 if
+//! the id may be shared with another thread running at the same time
+RAJA_INLINE int cpuWorkerId()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  // thread ids repeat across the teams of nested parallel regions
+  if (omp_get_level() > 1) return -1;
+  if (omp_in_parallel()) return omp_get_thread_num();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+  int tid = ::tbb::this_task_arena::current_thread_index();
+  if (tid >= 0) return tid;
+#endif
+  return 0;
+}
+
+}  // namespace detail
+
+
+/*!
+ * Thread-private shared memory.
+ *
+ * The object created by the user owns one cache-line aligned buffer per
+ * worker thread, taken once from a basic_mempool. Copies made on the same
+ * thread alias one buffer, as with cpu_shmem, so data loaded by an outer
+ * statement is seen by inner ones. Copies made by a parallel For or Tile
+ * (thread privatization) on another thread use that thread's buffer, so
+ * each worker tiles in its own cache without heap allocation per launch.
+ * A thread of a nested parallel region has no buffer of its own, so the
+ * first copy made on it takes a private buffer from the pool.
+ */
+template <typename T, size_t NumElem>
+struct SharedMemory<cpu_thread_shmem, T, NumElem>
+    : public internal::SharedMemoryBase {
+  using self = SharedMemory<cpu_thread_shmem, T, NumElem>;
+  using element_t = T;
+  using pool_t = basic_mempool::MemPool<basic_mempool::generic_allocator>;
+
+  static constexpr size_t size = NumElem;
+  static constexpr size_t num_bytes = NumElem * sizeof(T);
+  static constexpr size_t tile_bytes =
+      (num_bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+
+  T *data;
+  self const *root;
+  char *tiles;
+  int num_tiles;
+  //! buffer taken by a copy made in a nested parallel region
+  char *own;
+  //! thread that data belongs to, if it is not one of the tiles
+  std::thread::id own_thread;
+
+  RAJA_INLINE
+  SharedMemory()
+      : root(nullptr),
+        tiles(pool_t::getInstance().template malloc<char>(
+            detail::cpuWorkerCount() * tile_bytes,
+            CACHE_LINE_SIZE)),
+        num_tiles(detail::cpuWorkerCount()),
+        own(nullptr)
+  {
+    for (int t = 0; t < num_tiles; ++t) {
+      construct_tile(tiles + t * tile_bytes);
+    }
+    bind(nullptr);
+  }
+
+  RAJA_INLINE
+  ~SharedMemory()
+  {
+    if (own) {
+      destroy_tile(own);
+      pool_t::getInstance().free(own);
+    }
+    if (root == nullptr) {
+      for (int t = 0; t < num_tiles; ++t) {
+        destroy_tile(tiles + t * tile_bytes);
+      }
+      pool_t::getInstance().free(tiles);
+    }
+  }
+
+  RAJA_INLINE
+  SharedMemory(self const &c)
+      : root(c.root ? c.root : &c),
+        tiles(c.tiles),
+        num_tiles(c.num_tiles),
+        own(nullptr)
+  {
+    bind(&c);
+  }
+
+  self &operator=(self const &) = delete;
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  size_t shmem_setup_buffer(size_t) { return num_bytes; }
+
+  template <typename OffsetTuple>
+  RAJA_INLINE RAJA_HOST_DEVICE void shmem_set_window(OffsetTuple const &)
+  {
+  }
+
+
+  template <typename IDX>
+  RAJA_INLINE constexpr T &operator[](IDX i) const
+  {
+    return data[i];
+  }
+
+private:
+  static void construct_tile(char *tile)
+  {
+    for (size_t i = 0; i < NumElem; ++i) {
+      new (reinterpret_cast<T *>(tile) + i) T();
+    }
+  }
+
+  static void destroy_tile(char *tile)
+  {
+    for (size_t i = 0; i < NumElem; ++i) {
+      (reinterpret_cast<T *>(tile) + i)->~T();
+    }
+  }
+
+  // point data at the calling thread's buffer; copies made on the same
+  // thread of a nested region alias the buffer of the copy they came from
+  void bind(self const *c)
+  {
+    const int tid = detail::cpuWorkerId();
+    if (tid >= 0) {
+      data = get_tile(tid);
+    } else if (c && c->own_thread == std::this_thread::get_id()) {
+      data = c->data;
+      own_thread = c->own_thread;
+    } else {
+      own = pool_t::getInstance().template malloc<char>(tile_bytes,
+                                                        CACHE_LINE_SIZE);
+      construct_tile(own);
+      data = reinterpret_cast<T *>(own);
+      own_thread = std::this_thread::get_id();
+    }
+  }
+
+  T *get_tile(int tid) const
+  {
+    if (tid >= num_tiles) {
+      RAJA_ABORT_OR_THROW(
+          "cpu_thread_shmem used by more threads than it has buffers");
+    }
+    return reinterpret_cast<T *>(tiles + tid * tile_bytes);
+  }
+};
+
+
 }  // namespace RAJA
 
 #endif
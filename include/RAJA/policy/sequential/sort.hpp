@@ -0,0 +1,136 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_sequential_HPP
+#define RAJA_sort_sequential_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/sequential/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+//! executor running the tasks of the shared sort algorithms in order
+struct sequential_executor {
+  static int max_threads() { return 1; }
+
+  template <typename Body>
+  static void run(int num_tasks, Body body)
+  {
+    for (int t = 0; t < num_tasks; ++t) {
+      body(t);
+    }
+  }
+};
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> unstable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  std::sort(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>> stable(
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  std::stable_sort(begin, end, comp);
+}
+
+/*!
+        \brief sort given key range and values using comparison function on
+   keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+unstable_pairs(const ExecPolicy &,
+               KeyIter keys_begin,
+               KeyIter keys_end,
+               ValIter vals_begin,
+               Compare comp)
+{
+  detail::sort_pairs<detail::sequential_executor, false>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given key range and values using comparison
+   function on keys
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_sequential_policy<ExecPolicy>>
+stable_pairs(const ExecPolicy &,
+             KeyIter keys_begin,
+             KeyIter keys_end,
+             ValIter vals_begin,
+             Compare comp)
+{
+  detail::sort_pairs<detail::sequential_executor, true>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -36,6 +36,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 
@@ -43,7 +44,11 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/policy/simd/register.hpp"
 
 namespace RAJA
 {
@@ -67,6 +72,83 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+namespace detail
+{
+
+// contiguous ranges run N iterations at a time, then the remainder
+template <size_t N, typename StorageT, typename Func>
+RAJA_INLINE void forall_vector(const TypedRangeSegment<StorageT> &iter,
+                               Func &&loop_body)
+{
+  using index_t = typename std::decay<decltype(*std::begin(iter))>::type;
+  const index_t first = *std::begin(iter);
+  auto distance = std::distance(std::begin(iter), std::end(iter));
+
+  decltype(distance) i = 0;
+  for (; i + static_cast<decltype(distance)>(N) <= distance; i += N) {
+    loop_body(VectorIndex<index_t, N>(first + i, N));
+  }
+  if (i < distance) {
+    loop_body(VectorIndex<index_t, N>(first + i, distance - i));
+  }
+}
+
+// true if the n indices at list are consecutive
+template <typename T>
+RAJA_INLINE bool is_contiguous_block(T const *list, size_t n)
+{
+  bool contiguous = true;
+  for (size_t i = 1; i < n; ++i) {
+    contiguous &= (list[i] == list[0] + static_cast<T>(i));
+  }
+  return contiguous;
+}
+
+// list segments run in blocks of N indices; blocks of consecutive indices
+// are passed on as contiguous, others are gathered and scattered
+template <size_t N, typename T, typename Func>
+RAJA_INLINE void forall_vector(const TypedListSegment<T> &iter,
+                               Func &&loop_body)
+{
+  using vec_t = VectorIndex<T, N>;
+  T const *list = iter.begin();
+  const size_t len = iter.size();
+
+  // separate calls let the compiler specialize the body for each kind of
+  // block; the remainder shares them so the body stays small enough to
+  // inline
+  for (size_t i = 0; i < len; i += N) {
+    const size_t n = len - i < N ? len - i : N;
+    if (is_contiguous_block(list + i, n)) {
+      loop_body(vec_t(list[i], n));
+    } else {
+      loop_body(vec_t::from_list(list + i, n));
+    }
+  }
+}
+
+// other iterables run one iteration at a time
+template <size_t N, typename Iterable, typename Func>
+RAJA_INLINE void forall_vector(const Iterable &iter, Func &&loop_body)
+{
+  using index_t = typename std::decay<decltype(*std::begin(iter))>::type;
+  auto begin = std::begin(iter);
+  auto distance = std::distance(begin, std::end(iter));
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(VectorIndex<index_t, N>(*(begin + i), 1));
+  }
+}
+
+}  // namespace detail
+
+template <size_t N, typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const vector_exec<N> &,
+                             Iterable &&iter,
+                             Func &&loop_body)
+{
+  detail::forall_vector<N>(iter, loop_body);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -26,6 +26,8 @@
 #ifndef policy_simd_HPP
 #define policy_simd_HPP
 
+#include <cstddef>
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 //
@@ -52,11 +54,25 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// Runs ranges and list segments N iterations at a time; the loop body
+/// receives a VectorIndex of N iterations, or of fewer for the remainder at
+/// the end.
+///
+template <size_t N>
+struct vector_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+  static constexpr size_t num_elem = N;
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::vector_exec;
 
 }  // end of namespace RAJA
 
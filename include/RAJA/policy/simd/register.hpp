@@ -0,0 +1,812 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA SIMD register type, the vector
+ *          index passed to vector_exec loop bodies, and the View proxy used
+ *          to load and store registers.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_simd_register_HPP
+#define RAJA_simd_register_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+// GCC, Clang and Intel compilers map vector_size types to the widest
+// registers of the target, e.g. AVX2 or AVX-512 with -march=native
+#if defined(__GNUC__) || defined(__clang__)
+#define RAJA_SIMD_REGISTER_VECTOR_EXT
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX512F__)
+#define RAJA_SIMD_NATIVE_BYTES 64
+#elif defined(__AVX__)
+#define RAJA_SIMD_NATIVE_BYTES 32
+#else
+#define RAJA_SIMD_NATIVE_BYTES 16
+#endif
+
+namespace RAJA
+{
+
+/*!
+ * \brief Number of elements of type T in one register of the target.
+ */
+template <typename T>
+struct simd_native_width
+    : std::integral_constant<size_t,
+                             (RAJA_SIMD_NATIVE_BYTES / sizeof(T) > 0
+                                  ? RAJA_SIMD_NATIVE_BYTES / sizeof(T)
+                                  : 1)> {
+};
+
+namespace detail
+{
+
+template <typename T, size_t N>
+struct simd_storage {
+#if defined(RAJA_SIMD_REGISTER_VECTOR_EXT)
+  typedef T type __attribute__((vector_size(N * sizeof(T))));
+#else
+  struct type {
+    T lanes[N];
+    RAJA_INLINE T &operator[](size_t i) { return lanes[i]; }
+    RAJA_INLINE T const &operator[](size_t i) const { return lanes[i]; }
+  };
+#endif
+};
+
+// gathers and scatters N values through N indices, specialized below to
+// use the gather and scatter instructions of the target; registers load
+// and store other cases one element at a time
+template <typename T, size_t N, typename IdxT, typename Enable = void>
+struct simd_gather {
+  static constexpr bool has_gather = false;
+  static constexpr bool has_scatter = false;
+};
+
+template <typename IdxT, size_t Bytes>
+using simd_enable_index = typename std::
+    enable_if<std::is_integral<IdxT>::value && sizeof(IdxT) == Bytes>::type;
+
+#if defined(__AVX512F__)
+template <typename IdxT>
+struct simd_gather<double, 8, IdxT, simd_enable_index<IdxT, 8>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = true;
+  static RAJA_INLINE void gather(double *out, double const *ptr, IdxT const *idx)
+  {
+    __m512i vidx = _mm512_loadu_si512(idx);
+    _mm512_storeu_pd(out, _mm512_i64gather_pd(vidx, ptr, 8));
+  }
+  static RAJA_INLINE void scatter(double *ptr, IdxT const *idx, double const *in)
+  {
+    __m512i vidx = _mm512_loadu_si512(idx);
+    _mm512_i64scatter_pd(ptr, vidx, _mm512_loadu_pd(in), 8);
+  }
+};
+
+template <typename IdxT>
+struct simd_gather<double, 8, IdxT, simd_enable_index<IdxT, 4>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = true;
+  static RAJA_INLINE void gather(double *out, double const *ptr, IdxT const *idx)
+  {
+    __m256i vidx = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(idx));
+    _mm512_storeu_pd(out, _mm512_i32gather_pd(vidx, ptr, 8));
+  }
+  static RAJA_INLINE void scatter(double *ptr, IdxT const *idx, double const *in)
+  {
+    __m256i vidx = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(idx));
+    _mm512_i32scatter_pd(ptr, vidx, _mm512_loadu_pd(in), 8);
+  }
+};
+
+template <typename IdxT>
+struct simd_gather<float, 16, IdxT, simd_enable_index<IdxT, 4>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = true;
+  static RAJA_INLINE void gather(float *out, float const *ptr, IdxT const *idx)
+  {
+    __m512i vidx = _mm512_loadu_si512(idx);
+    _mm512_storeu_ps(out, _mm512_i32gather_ps(vidx, ptr, 4));
+  }
+  static RAJA_INLINE void scatter(float *ptr, IdxT const *idx, float const *in)
+  {
+    __m512i vidx = _mm512_loadu_si512(idx);
+    _mm512_i32scatter_ps(ptr, vidx, _mm512_loadu_ps(in), 4);
+  }
+};
+#endif
+
+#if defined(__AVX2__)
+// AVX2 has gathers but no scatters
+template <typename IdxT>
+struct simd_gather<double, 4, IdxT, simd_enable_index<IdxT, 8>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = false;
+  static RAJA_INLINE void gather(double *out, double const *ptr, IdxT const *idx)
+  {
+    __m256i vidx = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(idx));
+    _mm256_storeu_pd(out, _mm256_i64gather_pd(ptr, vidx, 8));
+  }
+};
+
+template <typename IdxT>
+struct simd_gather<double, 4, IdxT, simd_enable_index<IdxT, 4>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = false;
+  static RAJA_INLINE void gather(double *out, double const *ptr, IdxT const *idx)
+  {
+    __m128i vidx = _mm_loadu_si128(reinterpret_cast<__m128i const *>(idx));
+    _mm256_storeu_pd(out, _mm256_i32gather_pd(ptr, vidx, 8));
+  }
+};
+
+template <typename IdxT>
+struct simd_gather<float, 8, IdxT, simd_enable_index<IdxT, 4>> {
+  static constexpr bool has_gather = true;
+  static constexpr bool has_scatter = false;
+  static RAJA_INLINE void gather(float *out, float const *ptr, IdxT const *idx)
+  {
+    __m256i vidx = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(idx));
+    _mm256_storeu_ps(out, _mm256_i32gather_ps(ptr, vidx, 4));
+  }
+};
+#endif
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Register of N values of type T, with element-wise arithmetic.
+ *
+ * Arithmetic between registers, and between registers and scalars, maps to
+ * vector instructions of the target. Loads and stores that take a count n
+ * only touch the first n elements of memory; loads set the other elements
+ * to zero.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t N>
+class simd_register
+{
+  static_assert(std::is_arithmetic<T>::value,
+                "simd_register requires an arithmetic element type");
+  static_assert(N > 0 && (N & (N - 1)) == 0,
+                "simd_register width must be a power of two");
+
+  using storage_t = typename detail::simd_storage<T, N>::type;
+
+  storage_t m_value;
+
+  template <typename, size_t>
+  friend class simd_register;
+
+public:
+  using element_type = T;
+  static constexpr size_t num_elem = N;
+
+  //! uninitialized register
+  simd_register() = default;
+
+  //! register with all elements set to value
+  RAJA_INLINE simd_register(T value)
+  {
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] = value;
+    }
+  }
+
+  //! element-wise conversion from a register of another type
+  template <typename U>
+  RAJA_INLINE explicit simd_register(simd_register<U, N> const &other)
+  {
+#if defined(RAJA_SIMD_REGISTER_VECTOR_EXT) && defined(__has_builtin)
+#if __has_builtin(__builtin_convertvector)
+    m_value = __builtin_convertvector(other.m_value, storage_t);
+    return;
+#endif
+#endif
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] = static_cast<T>(other[i]);
+    }
+  }
+
+  //! load N contiguous values
+  RAJA_INLINE static simd_register load(T const *ptr)
+  {
+    simd_register r;
+    std::memcpy(&r.m_value, ptr, sizeof(storage_t));
+    return r;
+  }
+
+  //! load n contiguous values
+  RAJA_INLINE static simd_register load(T const *ptr, size_t n)
+  {
+    if (n >= N) return load(ptr);
+    T lanes[N] = {};
+    for (size_t i = 0; i < n; ++i) {
+      lanes[i] = ptr[i];
+    }
+    return load(lanes);
+  }
+
+  //! load n values that are stride elements apart
+  RAJA_INLINE static simd_register load_strided(T const *ptr,
+                                                Index_type stride,
+                                                size_t n = N)
+  {
+    T lanes[N] = {};
+    for (size_t i = 0; i < n && i < N; ++i) {
+      lanes[i] = ptr[i * stride];
+    }
+    return load(lanes);
+  }
+
+  //! load ptr[idx[i]] for the first n elements of idx
+  template <typename IdxT>
+  RAJA_INLINE static simd_register gather(T const *ptr,
+                                          IdxT const *idx,
+                                          size_t n = N)
+  {
+    using hw = detail::simd_gather<T, N, IdxT>;
+    return gather(std::integral_constant<bool, hw::has_gather>{},
+                  ptr,
+                  idx,
+                  n);
+  }
+
+  template <typename IdxT>
+  RAJA_INLINE static simd_register gather(T const *ptr,
+                                          simd_register<IdxT, N> const &idx,
+                                          size_t n = N)
+  {
+    IdxT lanes[N];
+    idx.store(lanes);
+    return gather(ptr, lanes, n);
+  }
+
+  //! store N contiguous values
+  RAJA_INLINE void store(T *ptr) const
+  {
+    std::memcpy(ptr, &m_value, sizeof(storage_t));
+  }
+
+  //! store the first n values contiguously
+  RAJA_INLINE void store(T *ptr, size_t n) const
+  {
+    if (n >= N) {
+      store(ptr);
+      return;
+    }
+    T lanes[N];
+    store(lanes);
+    for (size_t i = 0; i < n; ++i) {
+      ptr[i] = lanes[i];
+    }
+  }
+
+  //! store the first n values stride elements apart
+  RAJA_INLINE void store_strided(T *ptr, Index_type stride, size_t n = N) const
+  {
+    T lanes[N];
+    store(lanes);
+    for (size_t i = 0; i < n && i < N; ++i) {
+      ptr[i * stride] = lanes[i];
+    }
+  }
+
+  //! store value i to ptr[idx[i]] for the first n elements of idx
+  template <typename IdxT>
+  RAJA_INLINE void scatter(T *ptr, IdxT const *idx, size_t n = N) const
+  {
+    using hw = detail::simd_gather<T, N, IdxT>;
+    scatter(std::integral_constant<bool, hw::has_scatter>{}, ptr, idx, n);
+  }
+
+  template <typename IdxT>
+  RAJA_INLINE void scatter(T *ptr,
+                           simd_register<IdxT, N> const &idx,
+                           size_t n = N) const
+  {
+    IdxT lanes[N];
+    idx.store(lanes);
+    scatter(ptr, lanes, n);
+  }
+
+  RAJA_INLINE T operator[](size_t i) const { return m_value[i]; }
+
+  RAJA_INLINE T get(size_t i) const { return m_value[i]; }
+
+  RAJA_INLINE void set(size_t i, T value) { m_value[i] = value; }
+
+#if defined(RAJA_SIMD_REGISTER_VECTOR_EXT)
+  RAJA_INLINE simd_register &operator+=(simd_register const &x)
+  {
+    m_value += x.m_value;
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator-=(simd_register const &x)
+  {
+    m_value -= x.m_value;
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator*=(simd_register const &x)
+  {
+    m_value *= x.m_value;
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator/=(simd_register const &x)
+  {
+    m_value /= x.m_value;
+    return *this;
+  }
+  RAJA_INLINE simd_register operator-() const
+  {
+    simd_register r;
+    r.m_value = -m_value;
+    return r;
+  }
+#else
+  RAJA_INLINE simd_register &operator+=(simd_register const &x)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] += x.m_value[i];
+    }
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator-=(simd_register const &x)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] -= x.m_value[i];
+    }
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator*=(simd_register const &x)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] *= x.m_value[i];
+    }
+    return *this;
+  }
+  RAJA_INLINE simd_register &operator/=(simd_register const &x)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      m_value[i] /= x.m_value[i];
+    }
+    return *this;
+  }
+  RAJA_INLINE simd_register operator-() const
+  {
+    simd_register r;
+    RAJA_SIMD
+    for (size_t i = 0; i < N; ++i) {
+      r.m_value[i] = -m_value[i];
+    }
+    return r;
+  }
+#endif
+
+private:
+  template <typename IdxT>
+  RAJA_INLINE static simd_register gather(std::true_type,
+                                          T const *ptr,
+                                          IdxT const *idx,
+                                          size_t n)
+  {
+    if (n < N) return gather(std::false_type{}, ptr, idx, n);
+    T lanes[N];
+    detail::simd_gather<T, N, IdxT>::gather(lanes, ptr, idx);
+    return load(lanes);
+  }
+
+  template <typename IdxT>
+  RAJA_INLINE static simd_register gather(std::false_type,
+                                          T const *ptr,
+                                          IdxT const *idx,
+                                          size_t n)
+  {
+    if (n >= N) return gather(ptr, idx, camp::make_idx_seq_t<N>{});
+    T lanes[N] = {};
+    for (size_t i = 0; i < n; ++i) {
+      lanes[i] = ptr[idx[i]];
+    }
+    return load(lanes);
+  }
+
+  // builds the register from scalar loads without a round trip through
+  // memory
+  template <typename IdxT, camp::idx_t... Is>
+  RAJA_INLINE static simd_register gather(T const *ptr,
+                                          IdxT const *idx,
+                                          camp::idx_seq<Is...>)
+  {
+    simd_register r;
+    r.m_value = storage_t{ptr[idx[Is]]...};
+    return r;
+  }
+
+  template <typename IdxT>
+  RAJA_INLINE void scatter(std::true_type,
+                           T *ptr,
+                           IdxT const *idx,
+                           size_t n) const
+  {
+    if (n < N) {
+      scatter(std::false_type{}, ptr, idx, n);
+      return;
+    }
+    T lanes[N];
+    store(lanes);
+    detail::simd_gather<T, N, IdxT>::scatter(ptr, idx, lanes);
+  }
+
+  template <typename IdxT>
+  RAJA_INLINE void scatter(std::false_type,
+                           T *ptr,
+                           IdxT const *idx,
+                           size_t n) const
+  {
+    T lanes[N];
+    store(lanes);
+    for (size_t i = 0; i < n && i < N; ++i) {
+      ptr[idx[i]] = lanes[i];
+    }
+  }
+
+public:
+  //! sum of the first n elements
+  RAJA_INLINE T sum(size_t n = N) const
+  {
+    T result = 0;
+    for (size_t i = 0; i < n && i < N; ++i) {
+      result += m_value[i];
+    }
+    return result;
+  }
+
+  //! smallest of the first n elements
+  RAJA_INLINE T min(size_t n = N) const
+  {
+    T result = m_value[0];
+    for (size_t i = 1; i < n && i < N; ++i) {
+      result = m_value[i] < result ? m_value[i] : result;
+    }
+    return result;
+  }
+
+  //! largest of the first n elements
+  RAJA_INLINE T max(size_t n = N) const
+  {
+    T result = m_value[0];
+    for (size_t i = 1; i < n && i < N; ++i) {
+      result = m_value[i] > result ? m_value[i] : result;
+    }
+    return result;
+  }
+};
+
+/*!
+ * \brief simd_register of the native width of the target.
+ */
+template <typename T>
+using simd_native_register = simd_register<T, simd_native_width<T>::value>;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Index of up to N iterations, passed to vector_exec loop bodies.
+ *
+ * For ranges, and for blocks of list segments whose indices are
+ * consecutive, the iterations are first, first + 1, ..., first + size() - 1
+ * and contiguous is true. Other blocks of list segments hold their indices
+ * in lanes. size() is N except for the remainder at the end of a loop.
+ * Views indexed with a VectorIndex return a VectorRef that loads and stores
+ * only these iterations.
+ *
+ ******************************************************************************
+ */
+template <typename IdxT, size_t N>
+struct VectorIndex {
+  using index_type = IdxT;
+  using lanes_type = simd_register<Index_type, N>;
+  static constexpr size_t num_elem = N;
+
+  IdxT first;
+  size_t length;
+  bool contiguous;
+  //! indices of the iterations, only set if not contiguous
+  lanes_type lanes;
+
+  RAJA_INLINE VectorIndex(IdxT first, size_t length = N)
+      : first(first), length(length), contiguous(true)
+  {
+  }
+
+  //! block of the n indices in list
+  template <typename ListT>
+  RAJA_INLINE static VectorIndex from_list(ListT const *list, size_t n)
+  {
+    VectorIndex idx(static_cast<IdxT>(list[0]), n);
+    idx.contiguous = false;
+    idx.lanes = load_lanes(list, n);
+    return idx;
+  }
+
+  RAJA_INLINE static lanes_type load_lanes(Index_type const *list, size_t n)
+  {
+    return lanes_type::load(list, n);
+  }
+
+  template <typename ListT>
+  RAJA_INLINE static lanes_type load_lanes(ListT const *list, size_t n)
+  {
+    return lanes_type(simd_register<ListT, N>::load(list, n));
+  }
+
+  //! converts between index types, like scalar loop indices
+  template <typename OtherT>
+  RAJA_INLINE VectorIndex(VectorIndex<OtherT, N> const &other)
+      : first(static_cast<IdxT>(other.first)),
+        length(other.length),
+        contiguous(other.contiguous)
+  {
+    if (!contiguous) lanes = other.lanes;
+  }
+
+  //! number of active iterations
+  RAJA_INLINE constexpr size_t size() const { return length; }
+
+  //! true unless this is the remainder at the end of a loop
+  RAJA_INLINE constexpr bool is_full() const { return length == N; }
+
+  //! register holding the iteration numbers, inactive elements hold 0
+  template <typename T = IdxT>
+  RAJA_INLINE simd_register<T, N> indices() const
+  {
+    simd_register<T, N> r(T(0));
+    for (size_t i = 0; i < length; ++i) {
+      r.set(i,
+            contiguous ? static_cast<T>(first + i)
+                       : static_cast<T>(lanes[i]));
+    }
+    return r;
+  }
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reference to the elements of a View selected by a VectorIndex.
+ *
+ * Converts to a simd_register by loading the elements, and assigning a
+ * register (or a scalar) stores it. Only the active iterations of the
+ * VectorIndex are loaded or stored. Elements are loaded as a contiguous
+ * block when the VectorIndex is contiguous and the stride-one index of the
+ * View, with strided loads for other contiguous VectorIndex arguments, and
+ * with gather and scatter instructions otherwise.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t N>
+class VectorRef
+{
+public:
+  using element_type = typename std::remove_const<T>::type;
+  using register_type = simd_register<element_type, N>;
+  using offsets_type = simd_register<Index_type, N>;
+  static constexpr size_t num_elem = N;
+
+  //! elements ptr[0], ptr[stride], ...
+  RAJA_INLINE VectorRef(T *ptr, Index_type stride, size_t length)
+      : m_ptr(ptr), m_stride(stride), m_length(length), m_gathered(false)
+  {
+  }
+
+  //! elements ptr[offsets[0]], ptr[offsets[1]], ...
+  RAJA_INLINE VectorRef(T *ptr, offsets_type const &offsets, size_t length)
+      : m_ptr(ptr),
+        m_stride(0),
+        m_length(length),
+        m_gathered(true),
+        m_offsets(offsets)
+  {
+  }
+
+  RAJA_INLINE register_type load() const
+  {
+    if (m_gathered) {
+      return register_type::gather(m_ptr, m_offsets, m_length);
+    }
+    return m_stride == 1 ? register_type::load(m_ptr, m_length)
+                         : register_type::load_strided(m_ptr,
+                                                       m_stride,
+                                                       m_length);
+  }
+
+  RAJA_INLINE operator register_type() const { return load(); }
+
+  RAJA_INLINE void store(register_type const &value) const
+  {
+    if (m_gathered) {
+      value.scatter(m_ptr, m_offsets, m_length);
+    } else if (m_stride == 1) {
+      value.store(m_ptr, m_length);
+    } else {
+      value.store_strided(m_ptr, m_stride, m_length);
+    }
+  }
+
+  RAJA_INLINE VectorRef const &operator=(register_type const &value) const
+  {
+    store(value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator=(VectorRef const &other) const
+  {
+    store(other.load());
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator+=(register_type const &value) const
+  {
+    store(load() += value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator-=(register_type const &value) const
+  {
+    store(load() -= value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator*=(register_type const &value) const
+  {
+    store(load() *= value);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator/=(register_type const &value) const
+  {
+    store(load() /= value);
+    return *this;
+  }
+
+  RAJA_INLINE register_type operator-() const { return -load(); }
+
+  RAJA_INLINE T *data() const { return m_ptr; }
+  RAJA_INLINE size_t size() const { return m_length; }
+  RAJA_INLINE bool is_gathered() const { return m_gathered; }
+
+private:
+  T *m_ptr;
+  Index_type m_stride;
+  size_t m_length;
+  bool m_gathered;
+  offsets_type m_offsets;
+};
+
+namespace detail
+{
+
+template <typename X>
+struct simd_operand {
+  static constexpr bool is_vector = false;
+};
+
+template <typename T, size_t N>
+struct simd_operand<simd_register<T, N>> {
+  static constexpr bool is_vector = true;
+  using register_type = simd_register<T, N>;
+};
+
+template <typename T, size_t N>
+struct simd_operand<VectorRef<T, N>> {
+  static constexpr bool is_vector = true;
+  using register_type = typename VectorRef<T, N>::register_type;
+};
+
+// register type of a binary operation between registers, VectorRefs and
+// scalars; no type unless at least one operand is a register or VectorRef
+template <typename A,
+          typename B,
+          bool AVec = simd_operand<A>::is_vector,
+          bool BVec = simd_operand<B>::is_vector>
+struct simd_result {
+};
+
+template <typename A, typename B>
+struct simd_result<A, B, true, true>
+    : std::enable_if<
+          std::is_same<typename simd_operand<A>::register_type,
+                       typename simd_operand<B>::register_type>::value,
+          typename simd_operand<A>::register_type> {
+};
+
+template <typename A, typename B>
+struct simd_result<A, B, true, false>
+    : std::enable_if<std::is_arithmetic<B>::value,
+                     typename simd_operand<A>::register_type> {
+};
+
+template <typename A, typename B>
+struct simd_result<A, B, false, true>
+    : std::enable_if<std::is_arithmetic<A>::value,
+                     typename simd_operand<B>::register_type> {
+};
+
+}  // namespace detail
+
+template <typename A, typename B>
+RAJA_INLINE typename detail::simd_result<A, B>::type operator+(A const &a,
+                                                               B const &b)
+{
+  typename detail::simd_result<A, B>::type r(a);
+  return r += b;
+}
+
+template <typename A, typename B>
+RAJA_INLINE typename detail::simd_result<A, B>::type operator-(A const &a,
+                                                               B const &b)
+{
+  typename detail::simd_result<A, B>::type r(a);
+  return r -= b;
+}
+
+template <typename A, typename B>
+RAJA_INLINE typename detail::simd_result<A, B>::type operator*(A const &a,
+                                                               B const &b)
+{
+  typename detail::simd_result<A, B>::type r(a);
+  return r *= b;
+}
+
+template <typename A, typename B>
+RAJA_INLINE typename detail::simd_result<A, B>::type operator/(A const &a,
+                                                               B const &b)
+{
+  typename detail::simd_result<A, B>::type r(a);
+  return r /= b;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,144 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA compaction declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_compact_tbb_HPP
+#define RAJA_compact_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace compact
+{
+
+namespace detail
+{
+/*!
+        \brief parallel_scan body over the running kept count; the final
+   scan emits kept indices at their rank and, when partitioning, rejected
+   indices after the first total positions
+*/
+template <typename Index, typename Keep, typename Emit>
+struct select_adapter {
+  Index count;
+  Keep keep;
+  Emit emit;
+  bool emit_rejected;
+  Index total;
+
+  select_adapter(Keep keep_, Emit emit_, bool emit_rejected_, Index total_)
+      : count(0),
+        keep(keep_),
+        emit(emit_),
+        emit_rejected(emit_rejected_),
+        total(total_)
+  {
+  }
+
+  select_adapter(select_adapter& b, tbb::split)
+      : count(0),
+        keep(b.keep),
+        emit(b.emit),
+        emit_rejected(b.emit_rejected),
+        total(b.total)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<Index>& r, Tag)
+  {
+    Index temp = count;
+    for (Index i = r.begin(); i < r.end(); ++i) {
+      if (keep(i)) {
+        if (Tag::is_final_scan()) emit(i, temp);
+        ++temp;
+      } else if (Tag::is_final_scan() && emit_rejected) {
+        emit(i, total + (i - temp));
+      }
+    }
+    count = temp;
+  }
+
+  void reverse_join(const select_adapter& a) { count += a.count; }
+  void assign(const select_adapter& b) { count = b.count; }
+};
+}  // namespace detail
+
+/*!
+        \brief emit every index in [0, n) for which keep holds at its rank
+   among the kept indices; returns the number kept
+*/
+template <typename ExecPolicy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value,
+                        Index>::type
+select(const ExecPolicy&, Index n, Keep keep, Emit emit)
+{
+  detail::select_adapter<Index, Keep, Emit> adapter{keep, emit, false, 0};
+  tbb::parallel_scan(tbb::blocked_range<Index>{0, n}, adapter);
+  return adapter.count;
+}
+
+/*!
+        \brief stable partition of [0, n) by keep; returns the number kept
+*/
+template <typename ExecPolicy, typename Index, typename Keep, typename Emit>
+typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value,
+                        Index>::type
+partition(const ExecPolicy&, Index n, Keep keep, Emit emit)
+{
+  const Index total = tbb::parallel_reduce(
+      tbb::blocked_range<Index>{0, n},
+      Index(0),
+      [=](const tbb::blocked_range<Index>& r, Index count) {
+        for (Index i = r.begin(); i < r.end(); ++i) {
+          count += keep(i) ? 1 : 0;
+        }
+        return count;
+      },
+      [](Index a, Index b) { return a + b; });
+
+  detail::select_adapter<Index, Keep, Emit> adapter{keep, emit, true, total};
+  tbb::parallel_scan(tbb::blocked_range<Index>{0, n}, adapter);
+  return total;
+}
+
+}  // namespace compact
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
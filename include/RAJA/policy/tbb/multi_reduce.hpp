@@ -0,0 +1,70 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA multi-reduction templates for
+ *          TBB execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_tbb_multi_reduce_HPP
+#define RAJA_tbb_multi_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <mutex>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/multi_reduce.hpp"
+#include "RAJA/pattern/multi_reduce.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! one row of bins per thread slot of the current TBB arena
+struct MultiReduceTBBThreads {
+  using mutex_type = std::mutex;
+  static int max_threads()
+  {
+    return tbb::this_task_arena::max_concurrency();
+  }
+  static int thread_num()
+  {
+    return tbb::this_task_arena::current_thread_index();
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_MULTI_REDUCERS(tbb_reduce, detail::MultiReduceTBBThreads)
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,139 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <tbb/tbb.h>
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+//! executor running the tasks of the shared sort algorithms as TBB tasks
+struct tbb_executor {
+  static int max_threads() { return tbb::this_task_arena::max_concurrency(); }
+
+  template <typename Body>
+  static void run(int num_tasks, Body body)
+  {
+    tbb::parallel_for(tbb::blocked_range<int>(0, num_tasks, 1),
+                      [&](const tbb::blocked_range<int>& r) {
+                        for (int t = r.begin(); t < r.end(); ++t) {
+                          body(t);
+                        }
+                      });
+  }
+};
+}  // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> unstable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sort<detail::tbb_executor, false>(begin, end, comp);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> stable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::sort<detail::tbb_executor, true>(begin, end, comp);
+}
+
+/*!
+        \brief sort given key range and values using comparison function on
+   keys
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> unstable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sort_pairs<detail::tbb_executor, false>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+/*!
+        \brief stable sort given key range and values using comparison
+   function on keys
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<Policy>> stable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::sort_pairs<detail::tbb_executor, true>(
+      keys_begin, keys_end, vals_begin, comp);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
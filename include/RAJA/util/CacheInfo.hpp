@@ -0,0 +1,55 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file declaring queries for CPU data cache sizes.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CacheInfo_HPP
+#define RAJA_CacheInfo_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Size in bytes of the level 1, 2 or 3 data (or unified) cache of
+ *         the CPU running the program.
+ *
+ * Sizes are read once, from sysfs on Linux or sysconf elsewhere, and
+ * default to 32 KiB, 256 KiB and 8 MiB when the system does not report
+ * them. The environment variables RAJA_CACHE_L1, RAJA_CACHE_L2 and
+ * RAJA_CACHE_L3 override the detected sizes, e.g. RAJA_CACHE_L2=1M.
+ *
+ * Returns 0 for other levels.
+ *
+ ******************************************************************************
+ */
+size_t getCacheSize(int level);
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,371 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining per-thread scratch memory for use
+ *          inside loop bodies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ScratchArena_HPP
+#define RAJA_ScratchArena_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/task_arena.h>
+#endif
+
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Number of scratch lanes needed by an execution policy and the lane
+ *        of the calling thread; one lane per thread that may run the loop.
+ *        current() is negative for a thread whose id may be shared with
+ *        another thread running at the same time.
+ */
+template <typename ExecPolicy, typename Enable = void>
+struct scratch_lanes {
+  static int count() { return 1; }
+  static int current() { return 0; }
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <typename ExecPolicy>
+struct scratch_lanes<
+    ExecPolicy,
+    typename std::enable_if<
+        type_traits::is_openmp_policy<ExecPolicy>::value>::type> {
+  static int count() { return getMaxOMPThreadsCPU(); }
+  // thread ids repeat across the teams of nested parallel regions
+  static int current()
+  {
+    return omp_get_level() <= 1 ? getCurrentOMPThreadCPU() : -1;
+  }
+};
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+template <typename ExecPolicy>
+struct scratch_lanes<
+    ExecPolicy,
+    typename std::enable_if<type_traits::is_tbb_policy<ExecPolicy>::value>::type> {
+  static int count() { return ::tbb::this_task_arena::max_concurrency(); }
+  static int current()
+  {
+    int tid = ::tbb::this_task_arena::current_thread_index();
+    return tid < 0 ? 0 : tid;
+  }
+};
+#endif
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Per-thread bump allocator for temporary workspace in loop bodies.
+ *
+ * Capture a ScratchArena by value in a forall or kernel body and call get()
+ * to obtain workspace for the calling thread:
+ *
+ * \verbatim
+ *   RAJA::ScratchArena<RAJA::omp_parallel_for_exec> scratch;
+ *
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(range, [=](int i) {
+ *     double* w = scratch.get<double>(n);
+ *     ...
+ *   });
+ * \endverbatim
+ *
+ * Like reduction objects, the copies of the body made by the loop act as
+ * frames: the first copy to call get() on a thread opens a frame on that
+ * thread's lane, and everything obtained on the lane is released when that
+ * copy is destroyed, i.e. at the end of each thread's (OpenMP) or task's
+ * (TBB) chunk, or at the end of the loop for sequential policies. Use
+ * scope() to release workspace at the end of every iteration instead:
+ *
+ * \verbatim
+ *   auto s = scratch.scope();
+ *   double* w = scratch.get<double>(n);
+ * \endverbatim
+ *
+ * Each thread lane grows a list of blocks obtained from mempool on first
+ * use by that thread, so pages are first touched by the thread that uses
+ * them. Threads of nested parallel regions get a lane keyed by their
+ * system thread id, found under a lock. Blocks are kept for reuse until the last copy of the arena is
+ * destroyed. A ScratchArena must not be shared between loops that run at
+ * the same time.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy,
+          typename mempool =
+              basic_mempool::MemPool<basic_mempool::generic_allocator>>
+class ScratchArena
+{
+  using lanes = detail::scratch_lanes<ExecPolicy>;
+
+  enum : size_t { page_size = 4096 };
+
+  struct block {
+    char* ptr;
+    size_t capacity;
+  };
+
+  struct lane {
+    std::vector<block> blocks;
+    size_t idx = 0;
+    size_t top = 0;
+    std::atomic<const void*> frame{nullptr};
+    size_t frame_idx = 0;
+    size_t frame_top = 0;
+
+    lane() = default;
+    lane(const lane&) : lane() {}
+  };
+
+  struct state {
+    explicit state(size_t block_bytes)
+        : block_bytes(block_bytes), slots(lanes::count(), lane())
+    {
+    }
+
+    ~state()
+    {
+      for (int t = 0; t < slots.size(); ++t) {
+        for (block& b : slots[t].blocks) {
+          mempool::getInstance().free(b.ptr);
+        }
+      }
+      for (auto& e : extra) {
+        for (block& b : e.second.blocks) {
+          mempool::getInstance().free(b.ptr);
+        }
+      }
+    }
+
+    size_t block_bytes;
+    detail::ThreadSlots<lane> slots;
+
+    //! lanes of threads without a slot, e.g. in nested parallel regions
+    std::map<std::thread::id, lane> extra;
+    std::mutex extra_lock;
+    std::atomic<bool> has_extra{false};
+  };
+
+public:
+  //! position of a lane, see mark() and release()
+  struct marker {
+    size_t idx;
+    size_t top;
+  };
+
+  //! releases workspace obtained on the calling thread during its lifetime
+  class scoped
+  {
+  public:
+    explicit scoped(const ScratchArena& arena)
+        : m_arena(&arena), m_mark(arena.mark())
+    {
+    }
+    scoped(scoped&& other) : m_arena(other.m_arena), m_mark(other.m_mark)
+    {
+      other.m_arena = nullptr;
+    }
+    ~scoped()
+    {
+      if (m_arena) m_arena->release(m_mark);
+    }
+
+  private:
+    const ScratchArena* m_arena;
+    marker m_mark;
+  };
+
+  /*!
+   * \brief Create arena whose lanes allocate blocks of at least block_bytes.
+   */
+  explicit ScratchArena(size_t block_bytes = 64 * 1024)
+      : m_state(std::make_shared<state>(round_to_page(block_bytes)))
+  {
+  }
+
+  ScratchArena(const ScratchArena& other) : m_state(other.m_state) {}
+
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  ~ScratchArena()
+  {
+    for (int t = 0; t < m_state->slots.size(); ++t) {
+      close_frame(m_state->slots[t]);
+    }
+    if (m_state->has_extra.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> lock(m_state->extra_lock);
+      for (auto& e : m_state->extra) {
+        close_frame(e.second);
+      }
+    }
+  }
+
+  /*!
+   * \brief Return uninitialized workspace for n objects of type T, valid
+   *        until this copy of the arena is destroyed.
+   */
+  template <typename T>
+  T* get(size_t n, size_t alignment = alignof(T)) const
+  {
+    lane& l = current_lane();
+    if (l.frame.load(std::memory_order_relaxed) == nullptr) {
+      l.frame_idx = l.idx;
+      l.frame_top = l.top;
+      l.frame.store(this, std::memory_order_relaxed);
+    }
+    return static_cast<T*>(bump(l, n * sizeof(T), alignment));
+  }
+
+  //! current position of the calling thread's lane
+  marker mark() const
+  {
+    lane& l = current_lane();
+    return marker{l.idx, l.top};
+  }
+
+  //! release workspace obtained on the calling thread after m was taken
+  void release(marker m) const
+  {
+    lane& l = current_lane();
+    l.idx = m.idx;
+    l.top = m.top;
+  }
+
+  //! release workspace obtained on the calling thread when scope ends
+  scoped scope() const { return scoped(*this); }
+
+  //! bytes held by all lanes
+  size_t capacity() const
+  {
+    size_t total = 0;
+    for (int t = 0; t < m_state->slots.size(); ++t) {
+      for (block const& b : m_state->slots[t].blocks) {
+        total += b.capacity;
+      }
+    }
+    std::lock_guard<std::mutex> lock(m_state->extra_lock);
+    for (auto const& e : m_state->extra) {
+      for (block const& b : e.second.blocks) {
+        total += b.capacity;
+      }
+    }
+    return total;
+  }
+
+private:
+  static size_t round_to_page(size_t nbytes)
+  {
+    return (nbytes + page_size - 1) / page_size * page_size;
+  }
+
+  // release the workspace of a frame opened by this copy
+  void close_frame(lane& l) const
+  {
+    if (l.frame.load(std::memory_order_acquire) == this) {
+      l.idx = l.frame_idx;
+      l.top = l.frame_top;
+      l.frame.store(nullptr, std::memory_order_release);
+    }
+  }
+
+  lane& current_lane() const
+  {
+    const int tid = lanes::current();
+    if (tid < 0) {
+      // map nodes do not move, so the lane outlives the lock
+      std::lock_guard<std::mutex> lock(m_state->extra_lock);
+      m_state->has_extra.store(true, std::memory_order_release);
+      return m_state->extra[std::this_thread::get_id()];
+    }
+    if (tid >= m_state->slots.size()) {
+      RAJA_ABORT_OR_THROW("ScratchArena used by more threads than it has lanes");
+    }
+    return m_state->slots[tid];
+  }
+
+  // returns aligned memory at the top of the lane, moving to a later block
+  // when the current one is full; blocks past the top are unused and may be
+  // replaced by larger ones
+  void* bump(lane& l, size_t nbytes, size_t alignment) const
+  {
+    while (l.idx < l.blocks.size()) {
+      block& b = l.blocks[l.idx];
+      size_t offset = (l.top + alignment - 1) / alignment * alignment;
+      if (offset + nbytes <= b.capacity) {
+        l.top = offset + nbytes;
+        return b.ptr + offset;
+      }
+      ++l.idx;
+      l.top = 0;
+      if (l.idx < l.blocks.size() && l.blocks[l.idx].capacity < nbytes) {
+        mempool::getInstance().free(l.blocks[l.idx].ptr);
+        l.blocks.erase(l.blocks.begin() + l.idx);
+      }
+    }
+
+    size_t capacity = m_state->block_bytes;
+    if (!l.blocks.empty()) {
+      capacity = std::max(capacity, 2 * l.blocks.back().capacity);
+    }
+    capacity = std::max(capacity, round_to_page(nbytes + alignment));
+    char* ptr = mempool::getInstance().template malloc<char>(
+        capacity, std::max(size_t(page_size), alignment));
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("ScratchArena failed to allocate block");
+    }
+    l.blocks.push_back(block{ptr, capacity});
+    l.idx = l.blocks.size() - 1;
+    l.top = nbytes;
+    return ptr;
+  }
+
+  std::shared_ptr<state> m_state;
+};
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
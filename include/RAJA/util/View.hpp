@@ -26,12 +26,17 @@
 #ifndef RAJA_VIEW_HPP
 #define RAJA_VIEW_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 
 #include "RAJA/config.hpp"
 
 #include "RAJA/pattern/atomic.hpp"
 
+#include "RAJA/policy/simd/register.hpp"
+
 #include "RAJA/util/Layout.hpp"
 
 #if defined(RAJA_ENABLE_CHAI)
@@ -41,6 +46,69 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+// number of VectorIndex arguments, and the type of the last one
+template <typename... Args>
+struct view_vector_args {
+  static constexpr size_t count = 0;
+  static constexpr size_t num_elem = 1;
+  using index_type = void;
+};
+
+template <typename Arg, typename... Args>
+struct view_vector_args<Arg, Args...> : view_vector_args<Args...> {
+};
+
+template <typename IdxT, size_t N, typename... Args>
+struct view_vector_args<VectorIndex<IdxT, N>, Args...> {
+  static constexpr size_t count = 1 + view_vector_args<Args...>::count;
+  static constexpr size_t num_elem = N;
+  using index_type = VectorIndex<IdxT, N>;
+};
+
+// the VectorIndex argument
+template <typename Vec, typename Arg, typename... Args>
+RAJA_INLINE Vec const &view_vector_index(Arg const &arg, Args const &... args);
+
+template <typename Vec, typename... Args>
+RAJA_INLINE Vec const &view_vector_index_impl(std::true_type,
+                                              Vec const &arg,
+                                              Args const &...)
+{
+  return arg;
+}
+
+template <typename Vec, typename Arg, typename... Args>
+RAJA_INLINE Vec const &view_vector_index_impl(std::false_type,
+                                              Arg const &,
+                                              Args const &... args)
+{
+  return view_vector_index<Vec>(args...);
+}
+
+template <typename Vec, typename Arg, typename... Args>
+RAJA_INLINE Vec const &view_vector_index(Arg const &arg, Args const &... args)
+{
+  return view_vector_index_impl<Vec>(std::is_same<Arg, Vec>{}, arg, args...);
+}
+
+// replaces the VectorIndex argument by value, other arguments are unchanged
+template <typename Arg>
+RAJA_INLINE Arg view_vector_at(Arg arg, Index_type)
+{
+  return arg;
+}
+
+template <typename IdxT, size_t N>
+RAJA_INLINE Index_type view_vector_at(VectorIndex<IdxT, N>, Index_type value)
+{
+  return value;
+}
+
+}  // namespace detail
+
 template <typename ValueType,
           typename LayoutType,
           typename PointerType = ValueType *>
@@ -88,12 +156,42 @@ struct View {
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename std::
+      enable_if<detail::view_vector_args<Args...>::count == 0,
+                value_type &>::type
+      operator()(Args... args) const
   {
     auto idx = stripIndexType(layout(args...));
     auto &value = data[idx];
     return value;
   }
+
+  // an argument that is a VectorIndex selects the elements of all of its
+  // iterations; the layout gives their distance in memory
+  template <typename... Args>
+  RAJA_INLINE typename std::enable_if<
+      detail::view_vector_args<Args...>::count == 1,
+      VectorRef<value_type, detail::view_vector_args<Args...>::num_elem>>::type
+  operator()(Args... args) const
+  {
+    using vec_t = typename detail::view_vector_args<Args...>::index_type;
+    using ref_t = VectorRef<value_type, vec_t::num_elem>;
+
+    vec_t const &vec = detail::view_vector_index<vec_t>(args...);
+    const Index_type first = stripIndexType(vec.first);
+    const Index_type offset =
+        stripIndexType(layout(detail::view_vector_at(args, first)...));
+    const Index_type stride =
+        stripIndexType(layout(detail::view_vector_at(args, first + 1)...))
+        - offset;
+
+    if (vec.contiguous) {
+      return ref_t(&data[offset], stride, vec.length);
+    }
+    return ref_t(&data[offset],
+                 (vec.lanes - first) * stride,
+                 vec.length);
+  }
 };
 
 template <typename ValueType,
@@ -195,6 +293,224 @@ struct AtomicViewWrapper<ViewType, RAJA::atomic::seq_atomic> {
 };
 
 
+namespace atomic
+{
+
+/*!
+ * \brief Atomic policy for AtomicViewWrapper that combines updates in
+ *        software before they reach the shared array.
+ *
+ * Each copy of the view (e.g., the copy in each thread's loop body) adds
+ * += and -= updates into a private direct-mapped table of TableSize
+ * entries, and applies them with AtomicPolicy only when an entry is evicted
+ * by another element or the copy is destroyed at the end of the loop. Other
+ * accesses first apply the update buffered for that element. TableSize must
+ * be a power of two and should cover the distance between elements that are
+ * updated close together; 0 turns buffering off. Host only.
+ */
+template <typename AtomicPolicy = auto_atomic, size_t TableSize = 1024>
+struct privatized_atomic {
+};
+
+}  // namespace atomic
+
+namespace detail
+{
+
+/*!
+ * Direct-mapped table of pending additions, keyed by element address so that
+ * consecutive elements get consecutive entries. Entries are allocated on the
+ * first update.
+ */
+template <typename T, typename AtomicPolicy, size_t TableSize>
+class PrivatizedAtomicTable
+{
+  static_assert((TableSize & (TableSize - 1)) == 0,
+                "privatized_atomic table size must be a power of two");
+
+public:
+  PrivatizedAtomicTable() = default;
+  PrivatizedAtomicTable(PrivatizedAtomicTable const &) = delete;
+  PrivatizedAtomicTable &operator=(PrivatizedAtomicTable const &) = delete;
+
+  ~PrivatizedAtomicTable() { flush(); }
+
+  void add(T *ptr, T value)
+  {
+    if (!m_entries) {
+      m_entries.reset(new entry[TableSize]());
+    }
+    entry &e = m_entries[slot(ptr)];
+    if (e.ptr != ptr) {
+      evict(e);
+      e.ptr = ptr;
+    }
+    e.value += value;
+  }
+
+  //! apply the update buffered for ptr, if any
+  void flush(T *ptr)
+  {
+    if (m_entries && m_entries[slot(ptr)].ptr == ptr) {
+      evict(m_entries[slot(ptr)]);
+    }
+  }
+
+  //! apply all buffered updates
+  void flush()
+  {
+    if (m_entries) {
+      for (size_t i = 0; i < TableSize; ++i) {
+        evict(m_entries[i]);
+      }
+    }
+  }
+
+private:
+  struct entry {
+    T *ptr;
+    T value;
+  };
+
+  static size_t slot(T *ptr)
+  {
+    return (reinterpret_cast<std::uintptr_t>(ptr) / sizeof(T))
+           & (TableSize - 1);
+  }
+
+  static void evict(entry &e)
+  {
+    if (e.ptr && e.value != T(0)) {
+      RAJA::atomic::atomicAdd<AtomicPolicy>(e.ptr, e.value);
+    }
+    e.ptr = nullptr;
+    e.value = T(0);
+  }
+
+  std::unique_ptr<entry[]> m_entries;
+};
+
+/*!
+ * Element of a privatized atomic view. += and -= are buffered when the view
+ * has a table and return nothing, since the shared value is not known then.
+ */
+template <typename T, typename AtomicPolicy, size_t TableSize>
+class PrivatizedAtomicRef
+{
+public:
+  using table_type = PrivatizedAtomicTable<T, AtomicPolicy, TableSize>;
+
+  RAJA_INLINE PrivatizedAtomicRef(T *ptr, table_type *table)
+      : m_ptr(ptr), m_table(table)
+  {
+  }
+
+  RAJA_INLINE void operator+=(T rhs) const
+  {
+    if (m_table) {
+      m_table->add(m_ptr, rhs);
+    } else {
+      RAJA::atomic::atomicAdd<AtomicPolicy>(m_ptr, rhs);
+    }
+  }
+
+  RAJA_INLINE void operator-=(T rhs) const
+  {
+    if (m_table) {
+      m_table->add(m_ptr, T(0) - rhs);
+    } else {
+      RAJA::atomic::atomicSub<AtomicPolicy>(m_ptr, rhs);
+    }
+  }
+
+  RAJA_INLINE void operator++() const { *this += T(1); }
+  RAJA_INLINE void operator++(int) const { *this += T(1); }
+  RAJA_INLINE void operator--() const { *this -= T(1); }
+  RAJA_INLINE void operator--(int) const { *this -= T(1); }
+
+  //! the shared element, with this copy's buffered update applied
+  RAJA_INLINE RAJA::atomic::AtomicRef<T, AtomicPolicy> atomic() const
+  {
+    flush();
+    return RAJA::atomic::AtomicRef<T, AtomicPolicy>(m_ptr);
+  }
+
+  RAJA_INLINE T operator=(T rhs) const { return atomic() = rhs; }
+
+  RAJA_INLINE operator T() const
+  {
+    flush();
+    return *m_ptr;
+  }
+
+private:
+  RAJA_INLINE void flush() const
+  {
+    if (m_table) {
+      m_table->flush(m_ptr);
+    }
+  }
+
+  T *m_ptr;
+  table_type *m_table;
+};
+
+}  // namespace detail
+
+/*
+ * Specialized AtomicViewWrapper for privatized_atomic. The view given to the
+ * constructor applies updates directly; its copies, such as those captured
+ * by loop bodies, buffer them until destroyed or flushed.
+ */
+template <typename ViewType, typename AtomicPolicy, size_t TableSize>
+struct AtomicViewWrapper<ViewType,
+                         RAJA::atomic::privatized_atomic<AtomicPolicy,
+                                                         TableSize>> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using atomic_type =
+      detail::PrivatizedAtomicRef<value_type, AtomicPolicy, TableSize>;
+  using table_type = typename atomic_type::table_type;
+
+  base_type base_;
+
+  RAJA_INLINE
+  explicit AtomicViewWrapper(ViewType const &view)
+      : base_{view}, m_buffered(false)
+  {
+  }
+
+  RAJA_INLINE
+  AtomicViewWrapper(AtomicViewWrapper const &other)
+      : base_{other.base_}, m_buffered(TableSize > 0)
+  {
+  }
+
+  AtomicViewWrapper &operator=(AtomicViewWrapper const &) = delete;
+
+  RAJA_INLINE void set_data(pointer_type data_ptr)
+  {
+    flush();
+    base_.set_data(data_ptr);
+  }
+
+  //! apply all updates buffered by this copy
+  RAJA_INLINE void flush() const { m_table.flush(); }
+
+  template <typename... ARGS>
+  RAJA_INLINE atomic_type operator()(ARGS &&... args) const
+  {
+    return atomic_type(&base_.operator()(std::forward<ARGS>(args)...),
+                       m_buffered ? &m_table : nullptr);
+  }
+
+private:
+  mutable table_type m_table;
+  bool m_buffered;
+};
+
+
 template <typename AtomicPolicy, typename ViewType>
 RAJA_INLINE AtomicViewWrapper<ViewType, AtomicPolicy> make_atomic_view(
     ViewType const &view)
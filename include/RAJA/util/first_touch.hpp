@@ -0,0 +1,200 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for NUMA-aware first-touch allocation and
+ *          initialization.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_first_touch_HPP
+#define RAJA_first_touch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+#include "RAJA/util/types.hpp"
+
+//
+// Operating systems place a page on the NUMA node of the thread that first
+// writes it. Touching memory with the static partition that later loops use
+// (omp_for_static<N>, omp_for_stable<N>) keeps each thread's part of an
+// array on its own node.
+//
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! page size used to align first-touch allocations
+const size_t first_touch_page_size = 4096;
+
+/*!
+ * \brief Call f(begin, end) on every block of [0, n) owned by the calling
+ *        thread, from a parallel region when profitable.
+ */
+template <typename Func>
+void first_touch_blocks(Index_type n,
+                        Index_type chunk,
+                        size_t nbytes,
+                        Func&& f)
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  if (!omp_in_parallel()
+      && nbytes >= first_touch_page_size * getMaxOMPThreadsCPU()) {
+#pragma omp parallel
+    forEachStaticBlock(
+        n, chunk, omp_get_thread_num(), omp_get_num_threads(), f);
+    return;
+  }
+#endif
+  (void)nbytes;
+  if (n > 0) f(Index_type(0), n);
+}
+
+//! page aligned allocation of n objects of elem_size bytes, zeroed in the
+//! static partition given by chunk
+inline void* allocate_first_touch(Index_type n,
+                                  size_t elem_size,
+                                  Index_type chunk)
+{
+  const size_t nbytes = n * elem_size;
+  char* ptr = static_cast<char*>(
+      allocate_aligned(first_touch_page_size, nbytes > 0 ? nbytes : 1));
+  if (ptr == nullptr) return nullptr;
+  first_touch_blocks(n, chunk, nbytes, [=](Index_type b, Index_type e) {
+    std::memset(ptr + b * elem_size, 0, (e - b) * elem_size);
+  });
+  return ptr;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Construct ptr[0, n) as copies of value in parallel, each element
+ *         written by the thread omp_for_static<ChunkSize> (or
+ *         omp_for_stable<ChunkSize>) assigns it to.
+ *
+ *         ChunkSize == 0 matches omp_for_stable<0>, i.e. one contiguous
+ *         block per thread.
+ *
+ ******************************************************************************
+ */
+template <unsigned int ChunkSize = 0, typename T>
+void first_touch(T* ptr, Index_type n, const T& value = T())
+{
+  detail::first_touch_blocks(n,
+                             Index_type(ChunkSize),
+                             n * sizeof(T),
+                             [=, &value](Index_type b, Index_type e) {
+                               for (Index_type i = b; i < e; ++i) {
+                                 new (ptr + i) T(value);
+                               }
+                             });
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Allocator whose memory is first touched in parallel.
+ *
+ *         Memory is page aligned and zeroed by the threads that
+ *         omp_for_stable<ChunkSize> (or omp_for_static<ChunkSize>) assigns
+ *         each element to, so it can be used as a std-style allocator (e.g.
+ *         for RAJAVec) or as a basic_mempool allocator:
+ *
+ * \verbatim
+ *   RAJA::RAJAVec<double, RAJA::first_touch_allocator<double>> v;
+ *   RAJA::basic_mempool::MemPool<RAJA::first_touch_allocator<>> pool;
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename T = char, unsigned int ChunkSize = 0>
+struct first_touch_allocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = first_touch_allocator<U, ChunkSize>;
+  };
+
+  first_touch_allocator() = default;
+
+  template <typename U>
+  first_touch_allocator(const first_touch_allocator<U, ChunkSize>&)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    T* ptr = static_cast<T*>(
+        detail::allocate_first_touch(n, sizeof(T), Index_type(ChunkSize)));
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+  }
+
+  void deallocate(T* ptr, size_t = 0) { free_aligned(ptr); }
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    return detail::allocate_first_touch(
+        (nbytes + sizeof(T) - 1) / sizeof(T), sizeof(T), Index_type(ChunkSize));
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    free_aligned(ptr);
+    return true;
+  }
+};
+
+template <typename T, typename U, unsigned int ChunkSize>
+bool operator==(const first_touch_allocator<T, ChunkSize>&,
+                const first_touch_allocator<U, ChunkSize>&)
+{
+  return true;
+}
+
+template <typename T, typename U, unsigned int ChunkSize>
+bool operator!=(const first_touch_allocator<T, ChunkSize>&,
+                const first_touch_allocator<U, ChunkSize>&)
+{
+  return false;
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
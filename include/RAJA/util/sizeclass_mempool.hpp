@@ -0,0 +1,469 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing a size-class memory pool with
+ *          per-thread caches.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SIZECLASS_MEMPOOL_HPP
+#define RAJA_SIZECLASS_MEMPOOL_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "RAJA/util/align.hpp"
+#include "RAJA/util/mutex.hpp"
+
+namespace RAJA
+{
+
+namespace basic_mempool
+{
+
+namespace detail
+{
+
+//! minimal spin lock guarding one lane of a SizeClassMemPool
+class spin_lock
+{
+public:
+  spin_lock() { m_flag.clear(); }
+
+  spin_lock(const spin_lock&) = delete;
+  spin_lock& operator=(const spin_lock&) = delete;
+
+  bool try_lock() { return !m_flag.test_and_set(std::memory_order_acquire); }
+
+  void lock()
+  {
+    while (m_flag.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+
+  void unlock() { m_flag.clear(std::memory_order_release); }
+
+private:
+  std::atomic_flag m_flag;
+};
+
+//! small process-wide id of the calling thread, assigned on first use
+inline unsigned this_thread_lane()
+{
+  static std::atomic<unsigned> next_lane{0};
+  static thread_local unsigned lane = next_lane++;
+  return lane;
+}
+
+} /* end namespace detail */
+
+
+/*! \class SizeClassMemPool
+ ******************************************************************************
+ *
+ * \brief  SizeClassMemPool is a drop-in alternative to MemPool with the same
+ * interface, e.g.
+ *
+ * using device_mempool_type =
+ *     basic_mempool::SizeClassMemPool<cuda::DeviceAllocator>;
+ *
+ * Arenas obtained from allocator_t are cut into blocks of block_size bytes,
+ * and each block serves a single power-of-two size class (64 bytes up to
+ * block_size). A request is rounded up to the smallest class holding both
+ * its size and its alignment, so malloc and free are O(1) and no map nodes
+ * are allocated.
+ *
+ * All bookkeeping is kept outside the pooled memory, so allocator_t may
+ * return memory the host cannot touch (device memory, for example).
+ *
+ * Each thread is mapped to one of num_lanes lanes that caches up to
+ * lane_capacity free chunks per size class. Lanes are guarded by their own
+ * spin lock and only take the pool mutex to refill or flush in batches. A
+ * thread that finds its lane busy goes straight to the pool.
+ *
+ * Requests larger than block_size, or aligned to more than max_alignment,
+ * get dedicated allocations that are kept and reused best fit until
+ * free_chunks() is called.
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class SizeClassMemPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  static inline SizeClassMemPool<allocator_t>& getInstance()
+  {
+    static SizeClassMemPool<allocator_t> pool{};
+    return pool;
+  }
+
+  static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
+
+  enum : size_t {
+    min_class_shift = 6,
+    block_shift = 20,
+    num_classes = block_shift - min_class_shift + 1,
+    block_size = size_t(1) << block_shift,
+    max_alignment = 4096,
+    num_lanes = 64,
+    lane_capacity = 16,
+    max_arenas = 64
+  };
+
+  SizeClassMemPool()
+      : m_num_arenas(0),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc()
+  {
+    for (size_t l = 0; l < num_lanes; ++l) {
+      std::fill(m_lanes[l].count, m_lanes[l].count + num_classes, 0);
+    }
+    for (size_t c = 0; c < num_classes; ++c) {
+      m_classes[c].bump = nullptr;
+      m_classes[c].bump_end = nullptr;
+    }
+  }
+
+  ~SizeClassMemPool()
+  {
+    // Only host-side bookkeeping is released here, see MemPool::~MemPool
+    for (size_t i = 0; i < m_num_arenas.load(); ++i) {
+      delete[] m_arenas[i].block_class;
+    }
+  }
+
+  SizeClassMemPool(const SizeClassMemPool&) = delete;
+  SizeClassMemPool& operator=(const SizeClassMemPool&) = delete;
+
+  void free_chunks()
+  {
+    for (size_t l = 0; l < num_lanes; ++l) {
+      m_lanes[l].lock.lock();
+      std::fill(m_lanes[l].count, m_lanes[l].count + num_classes, 0);
+      m_lanes[l].lock.unlock();
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    const size_t num_arenas = m_num_arenas.load();
+    m_num_arenas.store(0, std::memory_order_release);
+    for (size_t i = 0; i < num_arenas; ++i) {
+      m_alloc.free(m_arenas[i].allocation);
+      delete[] m_arenas[i].block_class;
+    }
+    for (size_t c = 0; c < num_classes; ++c) {
+      m_classes[c].free.clear();
+      m_classes[c].bump = nullptr;
+      m_classes[c].bump_end = nullptr;
+    }
+    for (large_chunk& chunk : m_large) {
+      m_alloc.free(chunk.allocation);
+    }
+    m_large.clear();
+  }
+
+  size_t arena_size()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return m_default_arena_size;
+  }
+
+  size_t arena_size(size_t new_size)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    size_t prev_size = m_default_arena_size;
+    m_default_arena_size = new_size;
+    return prev_size;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const size_t size = std::max(nTs * sizeof(T), size_t(1));
+    void* ptr = nullptr;
+
+    if (size <= block_size && alignment <= max_alignment) {
+      const size_t c = size_class(std::max(size, alignment));
+      lane_type& lane = m_lanes[detail::this_thread_lane() % num_lanes];
+      if (lane.lock.try_lock()) {
+        if (lane.count[c] == 0) {
+          refill(lane, c);
+        }
+        if (lane.count[c] > 0) {
+          ptr = lane.items[c][--lane.count[c]];
+        }
+        lane.lock.unlock();
+      } else {
+#if defined(RAJA_ENABLE_OPENMP)
+        lock_guard<omp::mutex> lock(m_mutex);
+#endif
+        ptr = get_chunk(c);
+      }
+    }
+
+    if (ptr == nullptr) {
+      ptr = get_large(size, alignment);
+    }
+
+    return static_cast<T*>(ptr);
+  }
+
+  void free(const void* cptr)
+  {
+    char* ptr = static_cast<char*>(const_cast<void*>(cptr));
+    if (ptr == nullptr) {
+      return;
+    }
+
+    const size_t num_arenas = m_num_arenas.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num_arenas; ++i) {
+      arena_type const& arena = m_arenas[i];
+      if (arena.begin <= ptr && ptr < arena.end) {
+        const size_t c =
+            arena.block_class[static_cast<size_t>(ptr - arena.begin)
+                              >> block_shift];
+        lane_type& lane = m_lanes[detail::this_thread_lane() % num_lanes];
+        if (lane.lock.try_lock()) {
+          if (lane.count[c] == lane_capacity) {
+            flush(lane, c);
+          }
+          lane.items[c][lane.count[c]++] = ptr;
+          lane.lock.unlock();
+        } else {
+#if defined(RAJA_ENABLE_OPENMP)
+          lock_guard<omp::mutex> lock(m_mutex);
+#endif
+          m_classes[c].free.push_back(ptr);
+        }
+        return;
+      }
+    }
+
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    for (large_chunk& chunk : m_large) {
+      if (chunk.used && chunk.ptr == ptr) {
+        chunk.used = false;
+        return;
+      }
+    }
+    fprintf(stderr, "Unknown pointer %p", cptr);
+  }
+
+private:
+  struct arena_type {
+    void* allocation;
+    char* begin;
+    char* end;
+    unsigned char* block_class;
+    size_t next_block;
+  };
+
+  struct class_type {
+    std::vector<void*> free;
+    char* bump;
+    char* bump_end;
+  };
+
+  struct large_chunk {
+    void* allocation;
+    size_t capacity;
+    void* ptr;
+    bool used;
+  };
+
+  struct RAJA_ALIGNED_ATTR(CACHE_LINE_SIZE) lane_type {
+    detail::spin_lock lock;
+    size_t count[num_classes];
+    void* items[num_classes][lane_capacity];
+  };
+
+  static size_t size_class(size_t nbytes)
+  {
+    size_t c = 0;
+    while ((size_t(1) << (c + min_class_shift)) < nbytes) {
+      ++c;
+    }
+    return c;
+  }
+
+  // take up to half a lane of chunks of class c from the pool
+  void refill(lane_type& lane, size_t c)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    while (lane.count[c] < lane_capacity / 2) {
+      void* ptr = get_chunk(c);
+      if (ptr == nullptr) {
+        break;
+      }
+      lane.items[c][lane.count[c]++] = ptr;
+    }
+  }
+
+  // return the older half of a full lane of class c to the pool
+  void flush(lane_type& lane, size_t c)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    const size_t keep = lane_capacity / 2;
+    class_type& cls = m_classes[c];
+    cls.free.insert(cls.free.end(), lane.items[c], lane.items[c] + keep);
+    std::copy(lane.items[c] + keep, lane.items[c] + lane.count[c], lane.items[c]);
+    lane.count[c] -= keep;
+  }
+
+  // pool mutex must be held
+  void* get_chunk(size_t c)
+  {
+    class_type& cls = m_classes[c];
+    if (!cls.free.empty()) {
+      void* ptr = cls.free.back();
+      cls.free.pop_back();
+      return ptr;
+    }
+    if (cls.bump == cls.bump_end) {
+      cls.bump = get_block(c);
+      if (cls.bump == nullptr) {
+        cls.bump_end = nullptr;
+        return nullptr;
+      }
+      cls.bump_end = cls.bump + block_size;
+    }
+    void* ptr = cls.bump;
+    cls.bump += size_t(1) << (c + min_class_shift);
+    return ptr;
+  }
+
+  // pool mutex must be held
+  char* get_block(size_t c)
+  {
+    size_t num_arenas = m_num_arenas.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < num_arenas; ++i) {
+      arena_type& arena = m_arenas[i];
+      if (arena.begin + arena.next_block * block_size < arena.end) {
+        arena.block_class[arena.next_block] = static_cast<unsigned char>(c);
+        return arena.begin + block_size * arena.next_block++;
+      }
+    }
+
+    if (num_arenas == max_arenas) {
+      return nullptr;
+    }
+
+    const size_t alloc_size =
+        std::max(m_default_arena_size, size_t(block_size)) + max_alignment;
+    void* allocation = m_alloc.malloc(alloc_size);
+    if (allocation == nullptr) {
+      return nullptr;
+    }
+
+    void* begin = allocation;
+    size_t space = alloc_size;
+    ::RAJA::align(max_alignment, block_size, begin, space);
+    const size_t num_blocks = space / block_size;
+
+    arena_type& arena = m_arenas[num_arenas];
+    arena.allocation = allocation;
+    arena.begin = static_cast<char*>(begin);
+    arena.end = arena.begin + num_blocks * block_size;
+    arena.block_class = new unsigned char[num_blocks];
+    arena.block_class[0] = static_cast<unsigned char>(c);
+    arena.next_block = 1;
+    m_num_arenas.store(num_arenas + 1, std::memory_order_release);
+
+    return arena.begin;
+  }
+
+  void* get_large(size_t size, size_t alignment)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    large_chunk* best = nullptr;
+    for (large_chunk& chunk : m_large) {
+      void* ptr = chunk.allocation;
+      size_t space = chunk.capacity;
+      if (!chunk.used && (best == nullptr || chunk.capacity < best->capacity)
+          && ::RAJA::align(alignment, size, ptr, space)) {
+        best = &chunk;
+        best->ptr = ptr;
+      }
+    }
+
+    if (best == nullptr) {
+      const size_t alloc_size = size + alignment;
+      void* allocation = m_alloc.malloc(alloc_size);
+      if (allocation == nullptr) {
+        return nullptr;
+      }
+      m_large.push_back(large_chunk{allocation, alloc_size, allocation, false});
+      best = &m_large.back();
+      size_t space = alloc_size;
+      ::RAJA::align(alignment, size, best->ptr, space);
+    }
+
+    best->used = true;
+    return best->ptr;
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_mutex;
+#endif
+
+  lane_type m_lanes[num_lanes];
+  class_type m_classes[num_classes];
+  arena_type m_arenas[max_arenas];
+  std::atomic<size_t> m_num_arenas;
+  std::vector<large_chunk> m_large;
+  size_t m_default_arena_size;
+  allocator_t m_alloc;
+};
+
+} /* end namespace basic_mempool */
+
+} /* end namespace RAJA */
+
+
+#endif /* RAJA_SIZECLASS_MEMPOOL_HPP */
@@ -23,7 +23,10 @@
 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include <vector>
+
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -193,4 +196,203 @@ void buildIndexSetAligned(
   }
 }
 
+namespace
+{
+
+// indices of the input handled by one task; fixed, so that the index set
+// built does not depend on the number of threads
+const Index_type builder_chunk_length = 1 << 14;
+
+// segment found by the builder, as positions in the input array
+struct SegmentDesc {
+  enum Kind { Range, RangeStride, List };
+
+  Kind kind;
+  Index_type pos;
+  Index_type len;
+  Index_type stride;
+};
+
+// largest multiple of align not greater than v, also for negative v
+Index_type alignDown(Index_type v, Index_type align)
+{
+  Index_type r = v % align;
+  return r < 0 ? v - r - align : v - r;
+}
+
+void appendList(std::vector<SegmentDesc>& out, Index_type pos, Index_type len)
+{
+  if (len <= 0) return;
+  if (!out.empty() && out.back().kind == SegmentDesc::List
+      && out.back().pos + out.back().len == pos) {
+    out.back().len += len;
+  } else {
+    out.push_back(SegmentDesc{SegmentDesc::List, pos, len, 1});
+  }
+}
+
+//
+// Splits the indices in positions [begin, end) that are not part of a
+// range into strided runs of at least stride_min_length indices and lists.
+//
+void classifyLoose(std::vector<SegmentDesc>& out,
+                   const Index_type* idx,
+                   Index_type begin,
+                   Index_type end,
+                   Index_type stride_min_length)
+{
+  Index_type list_begin = begin;
+  Index_type i = begin;
+  while (stride_min_length > 1 && i + stride_min_length <= end) {
+    const Index_type stride = idx[i + 1] - idx[i];
+    if (stride == 0 || stride == 1) {
+      ++i;
+      continue;
+    }
+    Index_type j = i + 2;
+    while (j < end && idx[j] - idx[j - 1] == stride) {
+      ++j;
+    }
+    if (j - i >= stride_min_length) {
+      appendList(out, list_begin, i - list_begin);
+      out.push_back(SegmentDesc{SegmentDesc::RangeStride, i, j - i, stride});
+      list_begin = j;
+      i = j;
+    } else {
+      // runs starting before j - 1 with this stride are even shorter
+      i = j - 1;
+    }
+  }
+  appendList(out, list_begin, end - list_begin);
+}
+
+//
+// Classifies the runs of consecutive indices that start in positions
+// [begin, end). The last run is followed past end; a run continued from
+// the previous chunk is left to the chunk it starts in.
+//
+void classifyChunk(std::vector<SegmentDesc>& out,
+                   const Index_type* idx,
+                   Index_type length,
+                   Index_type begin,
+                   Index_type end,
+                   Index_type range_min_length,
+                   Index_type range_align,
+                   Index_type stride_min_length)
+{
+  Index_type p = begin;
+  if (p > 0) {
+    while (p < end && idx[p] == idx[p - 1] + 1) {
+      ++p;
+    }
+  }
+
+  Index_type loose_begin = p;
+  while (p < end) {
+    Index_type q = p + 1;
+    while (q < length && idx[q] == idx[q - 1] + 1) {
+      ++q;
+    }
+
+    // the aligned part of the run becomes a range if it is long enough
+    if (q - p >= range_min_length) {
+      const Index_type v = idx[p];
+      const Index_type a = -alignDown(-v, range_align);
+      const Index_type b = alignDown(v + (q - p), range_align);
+      if (b - a >= range_min_length && b - a > 0) {
+        classifyLoose(out, idx, loose_begin, p + (a - v), stride_min_length);
+        out.push_back(SegmentDesc{SegmentDesc::Range, p + (a - v), b - a, 1});
+        loose_begin = p + (b - v);
+      }
+    }
+    p = q;
+  }
+  classifyLoose(out, idx, loose_begin, p, stride_min_length);
+}
+
+}  // namespace
+
+/*
+*************************************************************************
+*
+* Initialize index set with aligned Range, RangeStride and List segments
+* from array of indices with given length, classifying chunks of the input
+* in parallel.
+*
+*************************************************************************
+*/
+
+void buildTypedIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    const Index_type* const indices_in,
+    Index_type length,
+    Index_type range_min_length,
+    Index_type range_align,
+    Index_type stride_min_length)
+{
+  if (length <= 0) return;
+  if (range_align < 1) range_align = 1;
+
+  const Index_type num_chunks =
+      (length + builder_chunk_length - 1) / builder_chunk_length;
+  std::vector<std::vector<SegmentDesc> > found(num_chunks);
+
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    const Index_type begin = c * builder_chunk_length;
+    const Index_type end = begin + builder_chunk_length < length
+                               ? begin + builder_chunk_length
+                               : length;
+    classifyChunk(found[c],
+                  indices_in,
+                  length,
+                  begin,
+                  end,
+                  range_min_length,
+                  range_align,
+                  stride_min_length);
+  }
+
+  // join lists and strided runs that were split between chunks
+  std::vector<SegmentDesc> segs;
+  for (Index_type c = 0; c < num_chunks; ++c) {
+    for (SegmentDesc const& d : found[c]) {
+      if (d.kind == SegmentDesc::List) {
+        appendList(segs, d.pos, d.len);
+        continue;
+      }
+      if (d.kind == SegmentDesc::RangeStride && !segs.empty()) {
+        SegmentDesc& last = segs.back();
+        if (last.kind == SegmentDesc::RangeStride && last.stride == d.stride
+            && last.pos + last.len == d.pos
+            && indices_in[d.pos - 1] + d.stride == indices_in[d.pos]) {
+          last.len += d.len;
+          continue;
+        }
+      }
+      segs.push_back(d);
+    }
+  }
+
+  for (SegmentDesc const& d : segs) {
+    const Index_type first = indices_in[d.pos];
+    switch (d.kind) {
+      case SegmentDesc::Range:
+        iset.push_back(RangeSegment(first, first + d.len));
+        break;
+      case SegmentDesc::RangeStride:
+        iset.push_back(
+            RangeStrideSegment(first, first + d.len * d.stride, d.stride));
+        break;
+      case SegmentDesc::List:
+        iset.push_back(ListSegment(&indices_in[d.pos], d.len));
+        break;
+    }
+  }
+}
+
 }  // namespace RAJA
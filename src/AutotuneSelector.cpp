@@ -0,0 +1,246 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the autotuning MultiPolicy selector.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/policy/AutotuneSelector.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace RAJA
+{
+
+namespace
+{
+
+// serializes updates of files shared by several selectors
+std::mutex &fileMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+// name of the file written before it is moved over file; unique to this
+// process, as several processes (e.g. MPI ranks) may share file
+std::string tmpFileName(const std::string &file)
+{
+  std::ostringstream name;
+  name << file << ".tmp";
+#if defined(__unix__) || defined(__APPLE__)
+  char host[256] = {};
+  if (gethostname(host, sizeof(host) - 1) == 0) {
+    name << '.' << host;
+  }
+  name << '.' << getpid();
+#endif
+  return name.str();
+}
+
+// one line per tuned bucket: "<bucket> <num_policies> <policy> <site>"
+struct FileEntry {
+  int bucket;
+  int num_policies;
+  int policy;
+  std::string site;
+};
+
+std::vector<FileEntry> readEntries(const std::string &file)
+{
+  std::vector<FileEntry> entries;
+  std::ifstream in(file);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream fields(line);
+    FileEntry e;
+    if (!(fields >> e.bucket >> e.num_policies >> e.policy)) continue;
+    fields >> std::ws;
+    std::getline(fields, e.site);
+    if (!e.site.empty()) entries.push_back(e);
+  }
+  return entries;
+}
+
+}  // namespace
+
+struct AutotuneSelector::state {
+  struct bucket_state {
+    int chosen = -1;
+    std::vector<int> runs;
+    std::vector<double> best;
+  };
+
+  state(std::string site, int num_policies, std::string file, int trials)
+      : site(site), file(file), num_policies(num_policies), trials(trials)
+  {
+    if (this->file.empty()) {
+      if (const char *env = std::getenv("RAJA_AUTOTUNE_FILE")) {
+        this->file = env;
+      }
+    }
+    if (this->num_policies < 1) this->num_policies = 1;
+    if (this->trials < 1) this->trials = 1;
+    load();
+  }
+
+  bucket_state &get(int b)
+  {
+    bucket_state &s = buckets[b];
+    if (s.runs.empty()) {
+      s.runs.assign(num_policies, 0);
+      s.best.assign(num_policies, std::numeric_limits<double>::max());
+    }
+    return s;
+  }
+
+  void load()
+  {
+    if (file.empty()) return;
+    std::lock_guard<std::mutex> guard(fileMutex());
+    for (FileEntry const &e : readEntries(file)) {
+      if (e.site == site && e.num_policies == num_policies && e.policy >= 0
+          && e.policy < num_policies) {
+        get(e.bucket).chosen = e.policy;
+      }
+    }
+  }
+
+  // merges the choices of this site into the file, keeping other sites
+  void save()
+  {
+    if (file.empty()) return;
+    std::lock_guard<std::mutex> guard(fileMutex());
+    std::vector<FileEntry> entries;
+    for (FileEntry const &e : readEntries(file)) {
+      if (e.site != site || e.num_policies != num_policies
+          || buckets.count(e.bucket) == 0
+          || buckets[e.bucket].chosen < 0) {
+        entries.push_back(e);
+      }
+    }
+    for (auto const &b : buckets) {
+      if (b.second.chosen >= 0) {
+        entries.push_back(
+            FileEntry{b.first, num_policies, b.second.chosen, site});
+      }
+    }
+
+    // write a new file and move it into place so readers never see a
+    // partial file
+    const std::string tmp = tmpFileName(file);
+    {
+      std::ofstream out(tmp);
+      if (!out) return;
+      out << "# RAJA autotune choices: bucket num_policies policy site\n";
+      for (FileEntry const &e : entries) {
+        out << e.bucket << ' ' << e.num_policies << ' ' << e.policy << ' '
+            << e.site << '\n';
+      }
+      if (!out) {
+        out.close();
+        std::remove(tmp.c_str());
+        return;
+      }
+    }
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+    }
+  }
+
+  std::string site;
+  std::string file;
+  int num_policies;
+  int trials;
+  std::mutex mutex;
+  std::map<int, bucket_state> buckets;
+};
+
+AutotuneSelector::AutotuneSelector(std::string site,
+                                   int num_policies,
+                                   std::string file,
+                                   int trials)
+    : m_state(std::make_shared<state>(site, num_policies, file, trials))
+{
+}
+
+int AutotuneSelector::bucket(size_t length)
+{
+  int b = 0;
+  while (length > 0) {
+    length >>= 1;
+    ++b;
+  }
+  return b;
+}
+
+int AutotuneSelector::select(size_t length) const
+{
+  std::lock_guard<std::mutex> guard(m_state->mutex);
+  state::bucket_state &s = m_state->get(bucket(length));
+  if (s.chosen >= 0) return s.chosen;
+
+  int next = 0;
+  for (int p = 1; p < m_state->num_policies; ++p) {
+    if (s.runs[p] < s.runs[next]) next = p;
+  }
+  return next;
+}
+
+void AutotuneSelector::record(size_t length, int policy, double seconds) const
+{
+  std::lock_guard<std::mutex> guard(m_state->mutex);
+  state::bucket_state &s = m_state->get(bucket(length));
+  if (s.chosen >= 0 || policy < 0 || policy >= m_state->num_policies) return;
+
+  // compare time per iteration, lengths in a bucket differ by up to 2x
+  const double per_iter = seconds / static_cast<double>(length > 0 ? length : 1);
+  ++s.runs[policy];
+  if (per_iter < s.best[policy]) s.best[policy] = per_iter;
+
+  int fastest = 0;
+  for (int p = 0; p < m_state->num_policies; ++p) {
+    if (s.runs[p] < m_state->trials) return;
+    if (s.best[p] < s.best[fastest]) fastest = p;
+  }
+  s.chosen = fastest;
+  m_state->save();
+}
+
+int AutotuneSelector::chosen(size_t length) const
+{
+  std::lock_guard<std::mutex> guard(m_state->mutex);
+  return m_state->get(bucket(length)).chosen;
+}
+
+}  // namespace RAJA
@@ -0,0 +1,138 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for CPU data cache size queries.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/CacheInfo.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace RAJA
+{
+
+namespace
+{
+
+const int max_level = 3;
+
+// parses sizes such as "32768", "48K" or "1M"
+size_t parseSize(const std::string& str)
+{
+  std::istringstream in(str);
+  size_t value = 0;
+  char unit = '\0';
+  if (!(in >> value)) return 0;
+  in >> unit;
+  switch (unit) {
+    case 'K':
+    case 'k':
+      return value << 10;
+    case 'M':
+    case 'm':
+      return value << 20;
+    case 'G':
+    case 'g':
+      return value << 30;
+    default:
+      return value;
+  }
+}
+
+void readSysfs(size_t* sizes)
+{
+  for (int index = 0;; ++index) {
+    const std::string dir =
+        "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index);
+    std::ifstream level_file(dir + "/level");
+    if (!level_file) return;
+
+    int level = 0;
+    std::string type, size;
+    level_file >> level;
+    std::ifstream(dir + "/type") >> type;
+    std::ifstream(dir + "/size") >> size;
+
+    if (level >= 1 && level <= max_level && type != "Instruction") {
+      sizes[level] = parseSize(size);
+    }
+  }
+}
+
+void readSysconf(size_t* sizes)
+{
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+  const int names[max_level + 1] = {0,
+                                    _SC_LEVEL1_DCACHE_SIZE,
+                                    _SC_LEVEL2_CACHE_SIZE,
+                                    _SC_LEVEL3_CACHE_SIZE};
+  for (int level = 1; level <= max_level; ++level) {
+    if (sizes[level] == 0) {
+      long size = sysconf(names[level]);
+      if (size > 0) sizes[level] = static_cast<size_t>(size);
+    }
+  }
+#else
+  (void)sizes;
+#endif
+}
+
+struct CacheSizes {
+  size_t bytes[max_level + 1] = {0, 0, 0, 0};
+
+  CacheSizes()
+  {
+    readSysfs(bytes);
+    readSysconf(bytes);
+
+    const size_t defaults[max_level + 1] = {0, 32 << 10, 256 << 10, 8 << 20};
+    const char* env_names[max_level + 1] = {nullptr,
+                                            "RAJA_CACHE_L1",
+                                            "RAJA_CACHE_L2",
+                                            "RAJA_CACHE_L3"};
+    for (int level = 1; level <= max_level; ++level) {
+      if (const char* env = std::getenv(env_names[level])) {
+        size_t size = parseSize(env);
+        if (size > 0) bytes[level] = size;
+      }
+      if (bytes[level] == 0) bytes[level] = defaults[level];
+    }
+  }
+};
+
+}  // namespace
+
+size_t getCacheSize(int level)
+{
+  static const CacheSizes sizes;
+  if (level < 1 || level > max_level) return 0;
+  return sizes.bytes[level];
+}
+
+}  // namespace RAJA
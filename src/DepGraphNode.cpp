@@ -36,10 +36,10 @@ void DepGraphNode::print(std::ostream& os) const
   os << "DepGraphNode : sem, reload value = " << m_semaphore_value << " , "
      << m_semaphore_reload_value << std::endl;
 
-  os << "     num dep tasks = " << m_num_dep_tasks;
-  if (m_num_dep_tasks > 0) {
+  os << "     num dep tasks = " << m_dep_task.size();
+  if (!m_dep_task.empty()) {
     os << " ( ";
-    for (int jj = 0; jj < m_num_dep_tasks; ++jj) {
+    for (size_t jj = 0; jj < m_dep_task.size(); ++jj) {
       os << m_dep_task[jj] << "  ";
     }
     os << " )";
@@ -47,4 +47,35 @@ void DepGraphNode::print(std::ostream& os) const
   os << std::endl;
 }
 
+void DepGraph::finalize()
+{
+  for (int i = 0; i < m_size; ++i) {
+    m_nodes[i].semaphoreReloadValue() = 0;
+  }
+  for (int i = 0; i < m_size; ++i) {
+    const DepGraphNode& node = m_nodes[i];
+    for (int jj = 0; jj < node.numDepTasks(); ++jj) {
+      ++m_nodes[node.depTaskNum(jj)].semaphoreReloadValue();
+    }
+  }
+
+  m_roots.clear();
+  for (int i = 0; i < m_size; ++i) {
+    if (m_nodes[i].semaphoreReloadValue() == 0) {
+      m_roots.push_back(i);
+    }
+  }
+
+  reset();
+}
+
+void DepGraph::print(std::ostream& os) const
+{
+  os << "DepGraph : num nodes = " << m_size << std::endl;
+  for (int i = 0; i < m_size; ++i) {
+    os << "  node " << i << " : ";
+    m_nodes[i].print(os);
+  }
+}
+
 }  // namespace RAJA
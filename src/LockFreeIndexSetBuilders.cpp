@@ -53,6 +53,76 @@ namespace RAJA
  */
 #define PROFITABLE_ENTITY_THRESHOLD_BLOCK 100
 
+/*
+ * Number of segments each slab of planes is split into, and the minimum
+ * number of planes per segment. A zone update may touch the planes on
+ * either side of its own, so two segments of the same lane in neighboring
+ * slabs must be separated by at least two planes to be independent.
+ */
+#define LOCKFREE_BLOCK_LANES 2
+#define LOCKFREE_BLOCK_MIN_PLANES 2
+
+/*
+ * Cut numPlanes planes of planeSize consecutive indices into slabs, one
+ * per thread, each divided into LOCKFREE_BLOCK_LANES segments. Segments
+ * are pushed lane-major, so segment lane * numSlabs + s is lane "lane" of
+ * slab s. Neighboring segments share a boundary plane and are ordered by
+ * the dependency graph: within a slab lane l precedes lane l + 1, and
+ * lane 0 of slab s + 1 precedes the last lane of slab s. All segments of
+ * one lane may then run concurrently.
+ *
+ * Every two segments that share a plane are ordered as in the index set,
+ * so running the graph gives the same result as running the segments in
+ * order, lane 0 of every slab and then lane 1. It cannot give the result
+ * of lexical zone order, which would run the slabs one after the other.
+ */
+static void buildPlaneBlocks(RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                                 RAJA::ListSegment,
+                                                 RAJA::RangeStrideSegment>& iset,
+                             Index_type planeSize,
+                             Index_type numPlanes,
+                             int numThreads)
+{
+  const int lanes = LOCKFREE_BLOCK_LANES;
+
+  Index_type maxSlabs =
+      numPlanes / (lanes * LOCKFREE_BLOCK_MIN_PLANES);
+  int numSlabs = static_cast<int>(
+      (maxSlabs < numThreads) ? maxSlabs : Index_type(numThreads));
+
+  if (numSlabs < 2) {
+    /* Not profitable: a single segment with a trivial graph */
+    iset.push_back(RAJA::RangeSegment(0, planeSize * numPlanes));
+    iset.initDependencyGraph();
+    iset.finalizeDependencyGraph();
+    return;
+  }
+
+  for (int lane = 0; lane < lanes; ++lane) {
+    for (int s = 0; s < numSlabs; ++s) {
+      Index_type startPlane = s * numPlanes / numSlabs;
+      Index_type endPlane = (s + 1) * numPlanes / numSlabs;
+      Index_type len = endPlane - startPlane;
+      Index_type begin = startPlane + lane * len / lanes;
+      Index_type end = startPlane + (lane + 1) * len / lanes;
+      iset.push_back(
+          RAJA::RangeSegment(begin * planeSize, end * planeSize));
+    }
+  }
+
+  iset.initDependencyGraph();
+  RAJA::DepGraph& graph = iset.getDependencyGraph();
+  for (int s = 0; s < numSlabs; ++s) {
+    for (int lane = 0; lane + 1 < lanes; ++lane) {
+      graph.addDependency(lane * numSlabs + s, (lane + 1) * numSlabs + s);
+    }
+    if (s + 1 < numSlabs) {
+      graph.addDependency(s + 1, (lanes - 1) * numSlabs + s);
+    }
+  }
+  iset.finalizeDependencyGraph();
+}
+
 void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
@@ -63,144 +133,22 @@ void buildLockFreeBlockIndexset(
 {
   int numThreads = getMaxOMPThreadsCPU();
 
-  // printf("Lock-free created\n") ;
-
   if ((midDim | slowDim) == 0) /* 1d mesh */
   {
     if (fastDim / PROFITABLE_ENTITY_THRESHOLD_BLOCK <= 1) {
-      // printf("%d %d\n", 0, fastDim) ;
-      iset.push_back(RAJA::RangeSegment(0, fastDim));
+      buildPlaneBlocks(iset, fastDim, 1, numThreads);
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
-      int numSegments = numThreads * 3;
-      for (int lane = 0; lane < 3; ++lane) {
-        for (int i = lane; i < numSegments; i += 3) {
-          Index_type start = i * fastDim / numSegments;
-          Index_type end = (i + 1) * fastDim / numSegments;
-          // printf("%d %d\n", start, end) ;
-          iset.push_back(RAJA::RangeSegment(start, end));
-        }
-      }
+      buildPlaneBlocks(iset, 1, fastDim, numThreads);
     }
   } else if (slowDim == 0) /* 2d mesh */
   {
-    int rowsPerSegment = midDim / (3 * numThreads);
-    if (rowsPerSegment == 0) {
-      // printf("%d %d\n", 0, fastDim*midDim) ;
-      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim));
-    } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
-      for (int lane = 0; lane < 3; ++lane) {
-        for (int i = 0; i < numThreads; ++i) {
-          Index_type startRow = i * midDim / numThreads;
-          Index_type endRow = (i + 1) * midDim / numThreads;
-          Index_type start = startRow * fastDim;
-          Index_type end = endRow * fastDim;
-          Index_type len = end - start;
-          // printf("%d %d\n", start + (lane  )*len/3,
-          //                   start + (lane+1)*len/3  ) ;
-          iset.push_back(RAJA::RangeSegment(start + (lane)*len / 3,
-                                            start + (lane + 1) * len / 3));
-        }
-      }
-    }
+    buildPlaneBlocks(iset, fastDim, midDim, numThreads);
   } else { /* 3d mesh */
-
-    // this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              Index_type startPlane = i * slowDim / numThreads;
-              Index_type endPlane = (i + 1) * slowDim / numThreads;
-              Index_type start = startPlane * fastDim * midDim;
-              Index_type end = endPlane * fastDim * midDim;
-              Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
-
-          iset.finalizeDependencyGraph();
-        }
-    */
+    buildPlaneBlocks(iset, fastDim * midDim, slowDim, numThreads);
   }
 
   /* Print the dependency schedule for segments */
-  // iset.print(std::cout);
+  // iset.getDependencyGraph().print(std::cout);
 }
 
 /*
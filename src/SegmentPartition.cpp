@@ -0,0 +1,113 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the partition of index set segments into
+ *          parts of balanced cost.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cmath>
+
+#include "RAJA/internal/SegmentPartition.hpp"
+
+namespace RAJA
+{
+
+constexpr Index_type SegmentPartition::default_min_piece;
+
+SegmentPartition::SegmentPartition(const Index_type* icounts,
+                                   int num_segments,
+                                   Index_type total_length,
+                                   const double* costs,
+                                   int num_costs,
+                                   int num_parts,
+                                   Index_type min_piece)
+{
+  if (num_parts < 1) {
+    num_parts = 1;
+  }
+
+  auto length = [=](int seg) {
+    return (seg + 1 < num_segments ? icounts[seg + 1] : total_length)
+           - icounts[seg];
+  };
+  auto cost = [=](int seg) {
+    return (seg < num_costs && costs[seg] >= 0.0)
+               ? costs[seg]
+               : static_cast<double>(length(seg));
+  };
+
+  double total = 0.0;
+  for (int seg = 0; seg < num_segments; ++seg) {
+    total += cost(seg);
+  }
+
+  m_part_offsets.reserve(num_parts + 1);
+  m_part_offsets.push_back(0);
+  m_part_costs.assign(num_parts, 0.0);
+
+  auto close_part = [&]() {
+    m_part_offsets.push_back(static_cast<int>(m_pieces.size()));
+  };
+
+  int part = 0;
+  // cost of the segments before seg
+  double done = 0.0;
+  for (int seg = 0; seg < num_segments; ++seg) {
+    const Index_type len = length(seg);
+    const double seg_cost = cost(seg);
+    const double per_index = len > 0 ? seg_cost / len : 0.0;
+
+    Index_type begin = 0;
+    while (begin < len) {
+      const bool last_part = part == num_parts - 1;
+      const double bound = total * (part + 1) / num_parts;
+
+      // the part ends inside this segment unless it is the last one
+      Index_type end = len;
+      if (!last_part && per_index > 0.0 && done + seg_cost > bound) {
+        end = static_cast<Index_type>(std::llround((bound - done) / per_index));
+        if (end - begin < min_piece) {
+          end = begin;
+        } else if (len - end < min_piece) {
+          end = len;
+        }
+      }
+
+      if (end > begin) {
+        m_pieces.push_back(SegmentPiece{seg, begin, end});
+        m_part_costs[part] += per_index * (end - begin);
+      }
+      if (!last_part && (end < len || done + seg_cost >= bound)) {
+        close_part();
+        ++part;
+      }
+      begin = end;
+    }
+    done += seg_cost;
+  }
+
+  while (static_cast<int>(m_part_offsets.size()) <= num_parts) {
+    close_part();
+  }
+}
+
+}  // namespace RAJA
@@ -0,0 +1,166 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU compaction operations.
+///
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+// large enough that the parallel backends split the range into many chunks
+const int N = 200003;
+
+template <typename T>
+class Compact : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, 7);
+    data.resize(N);
+    for (auto& v : data) {
+      v = dist(gen);
+    }
+  }
+
+  std::vector<int> data;
+};
+
+TYPED_TEST_CASE_P(Compact);
+
+TYPED_TEST_P(Compact, compact)
+{
+  auto pred = [](int v) { return v % 3 == 0; };
+  std::vector<int> expected;
+  std::copy_if(this->data.begin(),
+               this->data.end(),
+               std::back_inserter(expected),
+               pred);
+
+  std::vector<int> out(N, -1);
+  auto count = RAJA::compact<TypeParam>(this->data.begin(),
+                                        this->data.end(),
+                                        out.begin(),
+                                        pred);
+
+  ASSERT_EQ(static_cast<long>(expected.size()), static_cast<long>(count));
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+  ASSERT_EQ(-1, out[count]);
+}
+
+TYPED_TEST_P(Compact, compact_container)
+{
+  std::vector<int> out(N);
+  auto count = RAJA::compact<TypeParam>(this->data, out.begin(), [](int v) {
+    return v > 100;
+  });
+  ASSERT_EQ(0, count);
+
+  count = RAJA::compact<TypeParam>(this->data, out.begin(), [](int v) {
+    return v >= 0;
+  });
+  ASSERT_EQ(N, count);
+  ASSERT_TRUE(std::equal(this->data.begin(), this->data.end(), out.begin()));
+}
+
+TYPED_TEST_P(Compact, compact_empty)
+{
+  int* none = nullptr;
+  int out = -1;
+  auto count =
+      RAJA::compact<TypeParam>(none, none, &out, [](int) { return true; });
+  ASSERT_EQ(0, count);
+  ASSERT_EQ(-1, out);
+}
+
+TYPED_TEST_P(Compact, partition)
+{
+  auto pred = [](int v) { return v < 2; };
+  std::vector<int> expected(this->data);
+  auto mid = std::stable_partition(expected.begin(), expected.end(), pred);
+
+  std::vector<int> out(N);
+  auto count = RAJA::partition<TypeParam>(this->data.begin(),
+                                          this->data.end(),
+                                          out.begin(),
+                                          pred);
+
+  ASSERT_EQ(mid - expected.begin(), count);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TYPED_TEST_P(Compact, unique)
+{
+  std::vector<int> expected;
+  std::unique_copy(this->data.begin(),
+                   this->data.end(),
+                   std::back_inserter(expected));
+
+  std::vector<int> out(N);
+  auto count = RAJA::unique<TypeParam>(this->data, out.begin());
+
+  ASSERT_EQ(static_cast<long>(expected.size()), static_cast<long>(count));
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TYPED_TEST_P(Compact, unique_compare)
+{
+  // runs of values in the same half are collapsed
+  auto same_half = [](int a, int b) { return (a < 4) == (b < 4); };
+  std::vector<int> expected;
+  std::unique_copy(this->data.begin(),
+                   this->data.end(),
+                   std::back_inserter(expected),
+                   same_half);
+
+  std::vector<int> out(N);
+  auto count = RAJA::unique<TypeParam>(this->data.begin(),
+                                       this->data.end(),
+                                       out.begin(),
+                                       same_half);
+
+  ASSERT_EQ(static_cast<long>(expected.size()), static_cast<long>(count));
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+REGISTER_TYPED_TEST_CASE_P(Compact,
+                           compact,
+                           compact_container,
+                           compact_empty,
+                           partition,
+                           unique,
+                           unique_compare);
+
+using CompactTypes = ::testing::Types<RAJA::seq_exec,
+                                      RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_exec
+#endif
+                                      >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(CPU, Compact, CompactTypes);
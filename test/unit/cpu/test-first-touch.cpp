@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for first-touch allocation and stable
+/// static partitions.
+///
+
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+TEST(FirstTouch, StaticBlocksCoverRange)
+{
+  for (int nthreads : {1, 3, 8}) {
+    for (long n : {0L, 5L, 1000L, 1003L}) {
+      for (long chunk : {0L, 1L, 7L, 64L}) {
+        std::vector<int> owner(n, -1);
+        for (int t = 0; t < nthreads; ++t) {
+          RAJA::detail::forEachStaticBlock(
+              n, chunk, t, nthreads, [&](long b, long e) {
+                ASSERT_LT(b, e);
+                for (long i = b; i < e; ++i) {
+                  ASSERT_EQ(-1, owner[i]);
+                  owner[i] = t;
+                }
+              });
+        }
+        for (long i = 0; i < n; ++i) {
+          ASSERT_NE(-1, owner[i]);
+          if (chunk > 0) {
+            ASSERT_EQ((i / chunk) % nthreads, owner[i]);
+          } else if (i > 0) {
+            ASSERT_LE(owner[i - 1], owner[i]);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(FirstTouch, FirstTouchInit)
+{
+  const int n = 100003;
+  std::vector<double> buf(n, 0.0);
+  RAJA::first_touch(buf.data(), n, 2.5);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(2.5, buf[i]);
+  }
+  RAJA::first_touch<16>(buf.data(), n, -1.0);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(-1.0, buf[i]);
+  }
+}
+
+TEST(FirstTouch, Allocator)
+{
+  RAJA::first_touch_allocator<double> alloc;
+  double* a = alloc.allocate(50000);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(a) % 4096);
+  for (int i = 0; i < 50000; ++i) {
+    ASSERT_EQ(0.0, a[i]);
+  }
+  alloc.deallocate(a, 50000);
+
+  RAJA::RAJAVec<int, RAJA::first_touch_allocator<int, 8>> vec;
+  for (int i = 0; i < 10000; ++i) {
+    vec.push_back(i);
+  }
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(i, vec[i]);
+  }
+
+  RAJA::basic_mempool::MemPool<RAJA::first_touch_allocator<>> pool;
+  pool.arena_size(1 << 20);
+  long* p = pool.malloc<long>(1000);
+  ASSERT_NE(nullptr, p);
+  p[999] = 7;
+  pool.free(p);
+  pool.free_chunks();
+
+  std::vector<RAJA::Index_type> idx(20000);
+  for (int i = 0; i < 20000; ++i) {
+    idx[i] = 3 * i;
+  }
+  RAJA::ListSegment seg(idx.data(), 20000);
+  ASSERT_TRUE(seg.indicesEqual(idx.data(), 20000));
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+template <typename Policy>
+static std::vector<int> thread_map(int n)
+{
+  std::vector<int> owner(n, -1);
+  int* o = owner.data();
+  RAJA::forall<Policy>(RAJA::RangeSegment(0, n),
+                       [=](int i) { o[i] = omp_get_thread_num(); });
+  return owner;
+}
+
+TEST(FirstTouch, StablePolicy)
+{
+  const int n = 12345;
+  const int nthreads = omp_get_max_threads();
+
+  auto first = thread_map<RAJA::omp_parallel_for_stable<>>(n);
+  for (int rep = 0; rep < 5; ++rep) {
+    ASSERT_EQ(first, thread_map<RAJA::omp_parallel_for_stable<>>(n));
+  }
+  for (int t = 0; t < nthreads; ++t) {
+    RAJA::detail::forEachStaticBlock(n, 0, t, nthreads, [&](int b, int e) {
+      for (int i = b; i < e; ++i) {
+        ASSERT_EQ(t, first[i]);
+      }
+    });
+  }
+
+  // with a chunk size the partition matches schedule(static, N)
+  auto chunked = thread_map<RAJA::omp_parallel_for_stable<32>>(n);
+  ASSERT_EQ(thread_map<RAJA::omp_parallel_for_static<32>>(n), chunked);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ((i / 32) % nthreads, chunked[i]);
+  }
+}
+
+TEST(FirstTouch, StablePolicyInRegion)
+{
+  const int n = 1000;
+  std::vector<int> count(n, 0);
+  int* c = count.data();
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    RAJA::forall<RAJA::omp_for_stable<4>>(RAJA::RangeSegment(0, n),
+                                          [=](int i) { c[i] += 1; });
+    // implicit barrier: every index was written before the second loop
+    RAJA::forall<RAJA::omp_for_stable<4>>(RAJA::RangeSegment(0, n),
+                                          [=](int i) { c[i] += 1; });
+  });
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(2, count[i]);
+  }
+}
+
+#endif
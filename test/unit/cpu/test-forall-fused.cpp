@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA forall_fused.
+///
+
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+const int N = 10007;
+
+template <typename T>
+class ForallFused : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(ForallFused);
+
+TYPED_TEST_P(ForallFused, PerIndexRange)
+{
+  std::vector<double> a(N, 0.0), b(N, 0.0), c(N, 0.0);
+  double* pa = a.data();
+  double* pb = b.data();
+  double* pc = c.data();
+
+  RAJA::forall_fused<TypeParam>(RAJA::RangeSegment(0, N),
+                                [=](int i) { pa[i] = i; },
+                                [=](int i) { pb[i] = 2.0 * pa[i]; },
+                                [=](int i) { pc[i] = pa[i] + pb[i]; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], double(i));
+    ASSERT_EQ(b[i], 2.0 * i);
+    ASSERT_EQ(c[i], 3.0 * i);
+  }
+}
+
+TYPED_TEST_P(ForallFused, PerIndexList)
+{
+  std::vector<int> idx;
+  for (int i = N - 1; i >= 0; i -= 3) {
+    idx.push_back(i);
+  }
+  RAJA::TypedListSegment<int> list(idx.data(), idx.size());
+
+  std::vector<int> a(N, 0), b(N, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::forall_fused<TypeParam>(list,
+                                [=](int i) { pa[i] += 1; },
+                                [=](int i) { pb[i] = pa[i] + i; });
+
+  for (int i = 0; i < N; ++i) {
+    const int hit = ((N - 1 - i) % 3 == 0) ? 1 : 0;
+    ASSERT_EQ(a[i], hit);
+    ASSERT_EQ(b[i], hit ? i + 1 : 0);
+  }
+}
+
+TYPED_TEST_P(ForallFused, Chunked)
+{
+  std::vector<int> a(N, -1), b(N, -1);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  // the second body reads a neighbor written by the first, which is only
+  // safe because both indices are in the same chunk
+  RAJA::forall_fused<TypeParam, 64>(RAJA::RangeSegment(0, N),
+                                    [=](int i) { pa[i] = i; },
+                                    [=](int i) {
+                                      int j = (i % 64 == 0) ? i : i - 1;
+                                      pb[i] = pa[j];
+                                    });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(a[i], i);
+    ASSERT_EQ(b[i], (i % 64 == 0) ? i : i - 1);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(ForallFused, PerIndexRange, PerIndexList, Chunked);
+
+using ForallFusedTypes = ::testing::Types<RAJA::seq_exec,
+                                          RAJA::loop_exec,
+                                          RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                          ,
+                                          RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                          ,
+                                          RAJA::tbb_for_exec,
+                                          RAJA::tbb_for_dynamic
+#endif
+                                          >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(CPU, ForallFused, ForallFusedTypes);
+
+TEST(ForallFused, Reductions)
+{
+  RAJA::ReduceSum<RAJA::seq_reduce, long> seq_sum(0);
+  RAJA::ReduceMax<RAJA::seq_reduce, long> seq_max(0);
+  RAJA::forall_fused<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                     [=](int i) { seq_sum += i; },
+                                     [=](int i) { seq_max.max(i); });
+  ASSERT_EQ(seq_sum.get(), long(N) * (N - 1) / 2);
+  ASSERT_EQ(seq_max.get(), N - 1);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReduceSum<RAJA::omp_reduce, long> omp_sum(0);
+  RAJA::ReduceMin<RAJA::omp_reduce, long> omp_min(N);
+  RAJA::forall_fused<RAJA::omp_parallel_for_exec, 100>(
+      RAJA::RangeSegment(0, N),
+      [=](int i) { omp_sum += i; },
+      [=](int i) { omp_min.min(i); });
+  ASSERT_EQ(omp_sum.get(), long(N) * (N - 1) / 2);
+  ASSERT_EQ(omp_min.get(), 0);
+#endif
+}
+
+TEST(ForallFused, IndexSet)
+{
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 100));
+  std::vector<RAJA::Index_type> idx{150, 120, 101};
+  iset.push_back(RAJA::ListSegment(idx.data(), idx.size()));
+  iset.push_back(RAJA::RangeSegment(200, 300));
+
+  std::vector<int> a(300, 0), b(300, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  RAJA::forall_fused<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset,
+      [=](RAJA::Index_type i) { pa[i] = 1; },
+      [=](RAJA::Index_type i) { pb[i] = pa[i] + 1; });
+
+  int count = 0;
+  for (int i = 0; i < 300; ++i) {
+    if (a[i]) {
+      ++count;
+      ASSERT_EQ(b[i], 2);
+    } else {
+      ASSERT_EQ(b[i], 0);
+    }
+  }
+  ASSERT_EQ(count, 203);
+}
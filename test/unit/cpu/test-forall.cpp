@@ -120,7 +120,15 @@ INSTANTIATE_TYPED_TEST_CASE_P(Sequential, ForallTest, SequentialTypes);
 using OpenMPTypes =
     ::testing::Types<ExecPolicy<seq_segit, omp_parallel_for_exec>,
                      ExecPolicy<omp_parallel_for_segit, seq_exec>,
-                     ExecPolicy<omp_parallel_for_segit, loop_exec> >;
+                     ExecPolicy<omp_parallel_for_segit, loop_exec>,
+                     ExecPolicy<seq_segit, omp_parallel_for_dynamic<4>>,
+                     ExecPolicy<omp_parallel_for_dynamic<>, seq_exec>,
+                     ExecPolicy<seq_segit, omp_parallel_for_guided<>>,
+                     ExecPolicy<omp_parallel_for_guided<2>, loop_exec>,
+                     ExecPolicy<seq_segit, omp_parallel_for_runtime>,
+                     ExecPolicy<omp_parallel_for_runtime, seq_exec>,
+                     ExecPolicy<omp_balanced_segit, seq_exec>,
+                     ExecPolicy<omp_balanced_segit, simd_exec> >;
 
 INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, ForallTest, OpenMPTypes);
 #endif
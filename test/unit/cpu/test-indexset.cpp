@@ -22,6 +22,9 @@
 #include "buildIndexSet.hpp"
 
 #include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <vector>
 
 class IndexSetTest : public ::testing::Test
 {
@@ -137,3 +140,305 @@ TEST(IndexSet, swap)
   ASSERT_EQ(0l, iset1.size());
   ASSERT_EQ(0lu, iset1.getLength());
 }
+
+static std::vector<RAJA::Index_type> flatten(UnitIndexSet const& iset)
+{
+  std::vector<RAJA::Index_type> out;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type i) { out.push_back(i); });
+  return out;
+}
+
+TEST(IndexSetBuilder, aligned_ranges_and_lists)
+{
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = 0; i < 100; ++i) idx.push_back(i);
+  idx.push_back(1000);
+  idx.push_back(1005);
+  idx.push_back(1003);
+  for (RAJA::Index_type i = 203; i < 300; ++i) idx.push_back(i);
+
+  UnitIndexSet iset;
+  RAJA::buildTypedIndexSetAligned(iset, idx.data(), idx.size(), 32, 4, 0);
+
+  UnitIndexSet ref;
+  ref.push_back(RAJA::RangeSegment(0, 100));
+  RAJA::Index_type loose[] = {1000, 1005, 1003, 203};
+  ref.push_back(RAJA::ListSegment(loose, 4));
+  ref.push_back(RAJA::RangeSegment(204, 300));
+
+  ASSERT_EQ(ref.size(), iset.size());
+  EXPECT_EQ(ref, iset);
+  EXPECT_EQ(idx, flatten(iset));
+}
+
+TEST(IndexSetBuilder, strided_runs)
+{
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = 0; i < 64; ++i) idx.push_back(i);
+  for (RAJA::Index_type i = 0; i < 40; ++i) idx.push_back(100 + 3 * i);
+  idx.push_back(7);
+  for (RAJA::Index_type i = 0; i < 40; ++i) idx.push_back(500 - 2 * i);
+
+  UnitIndexSet iset;
+  RAJA::buildTypedIndexSetAligned(iset, idx.data(), idx.size(), 32, 4, 16);
+
+  UnitIndexSet ref;
+  ref.push_back(RAJA::RangeSegment(0, 64));
+  ref.push_back(RAJA::RangeStrideSegment(100, 220, 3));
+  RAJA::Index_type loose[] = {7};
+  ref.push_back(RAJA::ListSegment(loose, 1));
+  ref.push_back(RAJA::RangeStrideSegment(500, 420, -2));
+
+  ASSERT_EQ(ref.size(), iset.size());
+  EXPECT_EQ(ref, iset);
+  EXPECT_EQ(idx, flatten(iset));
+
+  // without strided runs everything after the range is one list
+  UnitIndexSet lists;
+  RAJA::buildTypedIndexSetAligned(lists, idx.data(), idx.size(), 32, 4, 0);
+  ASSERT_EQ(2, lists.getNumSegments());
+  EXPECT_EQ(idx, flatten(lists));
+}
+
+TEST(IndexSetBuilder, large_mixed_input)
+{
+  // runs of varying length with gaps, strided runs and shuffled stretches,
+  // long enough to be split into many chunks
+  std::vector<RAJA::Index_type> idx;
+  RAJA::Index_type next = 3;
+  unsigned state = 12345u;
+  while (idx.size() < 300000) {
+    state = state * 1103515245u + 12345u;
+    const RAJA::Index_type len = 1 + (state >> 16) % 500;
+    const unsigned kind = (state >> 8) % 3;
+    const RAJA::Index_type stride = kind == 0 ? 1 : 2 + kind;
+    for (RAJA::Index_type i = 0; i < len; ++i) {
+      idx.push_back(next + i * stride);
+    }
+    next += len * stride + (state >> 4) % 7;
+    if (kind == 2) {
+      std::swap(idx[idx.size() - 1], idx[idx.size() - len / 2 - 1]);
+    }
+  }
+
+  UnitIndexSet iset;
+  RAJA::buildTypedIndexSetAligned(iset, idx.data(), idx.size());
+  EXPECT_EQ(idx, flatten(iset));
+  EXPECT_EQ(idx.size(), iset.getLength());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // the index set does not depend on the number of threads
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  UnitIndexSet serial;
+  RAJA::buildTypedIndexSetAligned(serial, idx.data(), idx.size());
+  omp_set_num_threads(4);
+  UnitIndexSet parallel;
+  RAJA::buildTypedIndexSetAligned(parallel, idx.data(), idx.size());
+  omp_set_num_threads(num_threads);
+
+  EXPECT_EQ(serial, iset);
+  EXPECT_EQ(serial, parallel);
+#endif
+}
+
+// one long range followed by many short lists, as after a remesh
+static UnitIndexSet make_unbalanced_set(std::vector<RAJA::Index_type>& lists)
+{
+  UnitIndexSet iset;
+  iset.push_back(RAJA::RangeSegment(0, 100000));
+  lists.resize(2000);
+  for (int i = 0; i < 2000; ++i) {
+    lists[i] = 100000 + 3 * i;
+  }
+  for (int i = 0; i < 200; ++i) {
+    iset.push_back(RAJA::ListSegment(&lists[10 * i], 10, RAJA::Unowned));
+  }
+  iset.push_back(RAJA::RangeStrideSegment(200000, 250000, 5));
+  return iset;
+}
+
+// checks that the parts of a partition cover each iteration once, in order
+static void check_partition_covers(UnitIndexSet const& iset,
+                                   RAJA::SegmentPartition const& partition)
+{
+  int seg = 0;
+  RAJA::Index_type next = 0;
+  for (int part = 0; part < partition.getNumParts(); ++part) {
+    for (const RAJA::SegmentPiece* piece = partition.partBegin(part);
+         piece != partition.partEnd(part);
+         ++piece) {
+      if (piece->segment != seg) {
+        ASSERT_EQ(iset.getStartingIcount(seg) + next,
+                  iset.getStartingIcount(piece->segment));
+        seg = piece->segment;
+        next = 0;
+      }
+      ASSERT_EQ(next, piece->begin);
+      ASSERT_LT(piece->begin, piece->end);
+      next = piece->end;
+    }
+  }
+  ASSERT_EQ(iset.getLength(),
+            static_cast<size_t>(iset.getStartingIcount(seg) + next));
+}
+
+TEST(SegmentPartition, balanced_parts)
+{
+  std::vector<RAJA::Index_type> lists;
+  UnitIndexSet iset = make_unbalanced_set(lists);
+
+  for (int num_parts : {1, 3, 4, 16, 64}) {
+    RAJA::SegmentPartition const& partition =
+        *iset.getSegmentPartition(num_parts);
+    ASSERT_EQ(num_parts, partition.getNumParts());
+    check_partition_covers(iset, partition);
+
+    // cuts are off by at most a minimum piece or a short segment
+    const double target = double(iset.getLength()) / num_parts;
+    for (int part = 0; part < num_parts; ++part) {
+      EXPECT_NEAR(target,
+                  partition.getPartCost(part),
+                  2 * RAJA::SegmentPartition::default_min_piece);
+    }
+  }
+}
+
+TEST(SegmentPartition, segment_costs)
+{
+  std::vector<RAJA::Index_type> lists;
+  UnitIndexSet iset = make_unbalanced_set(lists);
+  const double length = iset.getLength();
+
+  EXPECT_EQ(100000.0, iset.getSegmentCost(0));
+  EXPECT_EQ(10.0, iset.getSegmentCost(1));
+  EXPECT_EQ(10000.0, iset.getSegmentCost(201));
+
+  // the last list costs as much as everything else
+  iset.setSegmentCost(200, length);
+  EXPECT_EQ(length, iset.getSegmentCost(200));
+  RAJA::SegmentPartition const& partition = *iset.getSegmentPartition(2);
+  check_partition_covers(iset, partition);
+  ASSERT_EQ(2, partition.partEnd(1) - partition.partBegin(1));
+  EXPECT_EQ(200, partition.partBegin(1)->segment);
+  EXPECT_EQ(199, (partition.partEnd(0) - 1)->segment);
+
+  iset.setSegmentCost(200, -1.0);
+  EXPECT_EQ(10.0, iset.getSegmentCost(200));
+
+  // costs stay with their segments when segments are pushed in front
+  iset.setSegmentCost(1, 7.0);
+  iset.push_front(RAJA::RangeSegment(-10, 0));
+  EXPECT_EQ(10.0, iset.getSegmentCost(0));
+  EXPECT_EQ(7.0, iset.getSegmentCost(2));
+}
+
+TEST(SegmentPartition, cached)
+{
+  std::vector<RAJA::Index_type> lists;
+  UnitIndexSet iset = make_unbalanced_set(lists);
+
+  auto partition = iset.getSegmentPartition(4);
+  EXPECT_EQ(partition, iset.getSegmentPartition(4));
+
+  // copies share the partition
+  UnitIndexSet copy(iset);
+  EXPECT_EQ(partition, copy.getSegmentPartition(4));
+
+  // adding segments or setting costs rebuilds it
+  copy.push_back(RAJA::RangeSegment(300000, 301000));
+  check_partition_covers(copy, *copy.getSegmentPartition(4));
+  EXPECT_EQ(partition, iset.getSegmentPartition(4));
+  iset.setSegmentCost(0, 1.0);
+  check_partition_covers(iset, *iset.getSegmentPartition(4));
+
+  // a partition stays valid after the cached one is replaced
+  iset.getSegmentPartition(3);
+  EXPECT_EQ(4, partition->getNumParts());
+  check_partition_covers(iset, *partition);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSet, balanced_forall_Icount)
+{
+  std::vector<RAJA::Index_type> lists;
+  UnitIndexSet iset = make_unbalanced_set(lists);
+  const RAJA::Index_type len = iset.getLength();
+
+  std::vector<RAJA::Index_type> ref(len);
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type icount, RAJA::Index_type i) {
+        ref[icount] = i;
+      });
+
+  const int num_threads = omp_get_max_threads();
+  for (int threads : {1, 3, 8}) {
+    omp_set_num_threads(threads);
+    for (int rep = 0; rep < 2; ++rep) {
+      std::vector<RAJA::Index_type> out(len, -1);
+      RAJA::Index_type* o = out.data();
+      RAJA::ReduceSum<RAJA::omp_reduce, RAJA::Index_type> count(0);
+      RAJA::forall_Icount<
+          RAJA::ExecPolicy<RAJA::omp_balanced_segit, RAJA::simd_exec>>(
+          iset, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+            o[icount] = i;
+            count += 1;
+          });
+      EXPECT_EQ(len, count.get());
+      EXPECT_EQ(ref, out);
+    }
+  }
+
+  // in a fused region, the team splits the index set
+  omp_set_num_threads(4);
+  std::vector<int> visits(250000, 0);
+  int* v = visits.data();
+  RAJA::region<RAJA::omp_fused_region>([&]() {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_balanced_segit, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type i) { v[i] += 1; });
+  });
+  omp_set_num_threads(num_threads);
+  for (RAJA::Index_type i : ref) {
+    v[i] -= 1;
+  }
+  EXPECT_EQ(std::vector<int>(250000, 0), visits);
+}
+
+TEST(IndexSet, balanced_forall_concurrent)
+{
+  std::vector<RAJA::Index_type> lists;
+  UnitIndexSet const iset = make_unbalanced_set(lists);
+  const RAJA::Index_type len = iset.getLength();
+
+  // loops on every thread of a user region share the index set, and ask
+  // for partitions with different numbers of parts
+  std::vector<RAJA::Index_type> counts(4, 0);
+  RAJA::Index_type* c = counts.data();
+#pragma omp parallel num_threads(4)
+  {
+    const int t = omp_get_thread_num();
+    for (int rep = 0; rep < 20; ++rep) {
+      auto partition = iset.getSegmentPartition(1 + (t + rep) % 4);
+      RAJA::Index_type count = 0;
+      for (int part = 0; part < partition->getNumParts(); ++part) {
+        for (const RAJA::SegmentPiece* piece = partition->partBegin(part);
+             piece != partition->partEnd(part);
+             ++piece) {
+          count += piece->end - piece->begin;
+        }
+      }
+      RAJA::forall<
+          RAJA::ExecPolicy<RAJA::omp_balanced_segit, RAJA::seq_exec>>(
+          iset, [&](RAJA::Index_type) {
+#pragma omp atomic
+            count += 1;
+          });
+      c[t] += count;
+    }
+  }
+  for (RAJA::Index_type count : counts) {
+    EXPECT_EQ(2 * 20 * len, count);
+  }
+}
+#endif
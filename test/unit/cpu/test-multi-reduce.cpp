@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU multi-reduction operations.
+///
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+template <typename TUPLE>
+class MultiReduceCorrectnessTest : public ::testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    num_bins = 37;
+    array_length = 10007;
+
+    values.resize(array_length);
+    bins.resize(array_length);
+    for (int i = 0; i < array_length; ++i) {
+      values[i] = (i * 7919) % 1013 - 500;
+      bins[i] = (i * 31) % num_bins;
+    }
+
+    sums.assign(num_bins, 0);
+    mins.assign(num_bins, 100000);
+    maxs.assign(num_bins, -100000);
+    for (int i = 0; i < array_length; ++i) {
+      sums[bins[i]] += values[i];
+      mins[bins[i]] = std::min(mins[bins[i]], values[i]);
+      maxs[bins[i]] = std::max(maxs[bins[i]], values[i]);
+    }
+  }
+
+  int num_bins;
+  int array_length;
+  std::vector<int> values;
+  std::vector<int> bins;
+  std::vector<int> sums;
+  std::vector<int> mins;
+  std::vector<int> maxs;
+};
+
+TYPED_TEST_CASE_P(MultiReduceCorrectnessTest);
+
+TYPED_TEST_P(MultiReduceCorrectnessTest, MultiReduceSum)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  const int* values = this->values.data();
+  const int* bins = this->bins.data();
+
+  RAJA::MultiReduceSum<ReducePolicy, int> sums(this->num_bins, 5);
+  ASSERT_EQ((size_t)this->num_bins, sums.size());
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) { sums[bins[i]] += values[i]; });
+
+  std::vector<int> all = sums.get_all();
+  for (int b = 0; b < this->num_bins; ++b) {
+    ASSERT_EQ(this->sums[b] + 5, sums.get(b));
+    ASSERT_EQ(this->sums[b] + 5, all[b]);
+  }
+
+  // a second loop accumulates on top of the first
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) { sums[bins[i]] += values[i]; });
+
+  int raw[37];
+  sums.get_all(raw);
+  for (int b = 0; b < this->num_bins; ++b) {
+    ASSERT_EQ(2 * this->sums[b] + 5, raw[b]);
+  }
+
+  sums.reset(3);
+  ASSERT_EQ(3u, sums.size());
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) { sums[i % 3] += 1; });
+  ASSERT_EQ(this->array_length, sums.get(0) + sums.get(1) + sums.get(2));
+}
+
+TYPED_TEST_P(MultiReduceCorrectnessTest, MultiReduceMinMax)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  const int* values = this->values.data();
+  const int* bins = this->bins.data();
+
+  RAJA::MultiReduceMin<ReducePolicy, int> mins(this->num_bins);
+  RAJA::MultiReduceMax<ReducePolicy, int> maxs(this->num_bins);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, this->array_length),
+                           [=](int i) {
+                             mins[bins[i]].min(values[i]);
+                             maxs[bins[i]].max(values[i]);
+                           });
+
+  std::vector<int> all_mins = mins.get_all();
+  std::vector<int> all_maxs = maxs.get_all();
+  for (int b = 0; b < this->num_bins; ++b) {
+    ASSERT_EQ(this->mins[b], all_mins[b]);
+    ASSERT_EQ(this->maxs[b], all_maxs[b]);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(MultiReduceCorrectnessTest,
+                           MultiReduceSum,
+                           MultiReduceMinMax);
+
+using types = ::testing::Types<
+    std::tuple<RAJA::seq_exec, RAJA::seq_reduce>,
+    std::tuple<RAJA::loop_exec, RAJA::seq_reduce>
+#if defined(RAJA_ENABLE_OPENMP)
+    ,
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>,
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    ,
+    std::tuple<RAJA::tbb_for_exec, RAJA::tbb_reduce>,
+    std::tuple<RAJA::tbb_for_dynamic, RAJA::tbb_reduce>
+#endif
+    >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(MultiReduce, MultiReduceCorrectnessTest, types);
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(MultiReduceOMP, ThreadCountRaisedAfterConstruction)
+{
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+
+  RAJA::MultiReduceSum<RAJA::omp_reduce, long> sums(4);
+
+  omp_set_num_threads(max_threads + 3);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, 1000),
+                                            [=](int i) { sums[i % 4] += i; });
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQ(124500, sums.get(0));
+  ASSERT_EQ(499500, sums.get(0) + sums.get(1) + sums.get(2) + sums.get(3));
+}
+
+TEST(MultiReduceOMP, NestedParallelLoops)
+{
+  const int N = 64;
+
+  using KPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::omp_parallel_for_exec,
+      RAJA::statement::For<1,
+                           RAJA::omp_parallel_for_exec,
+                           RAJA::statement::Lambda<0>>>>;
+
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  // thread ids repeat across the inner teams, so no bin update may be lost
+  RAJA::MultiReduceSum<RAJA::omp_reduce, long> sums(5);
+  RAJA::kernel<KPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                      RAJA::RangeSegment(0, N)),
+                     [=](int i, int j) { sums[(i + j) % 5] += 1; });
+
+  omp_set_num_threads(max_threads);
+
+  long total = 0;
+  for (int b = 0; b < 5; ++b) {
+    total += sums.get(b);
+  }
+  ASSERT_EQ(N * N, total);
+  ASSERT_EQ(819, sums.get(0));
+}
+#endif
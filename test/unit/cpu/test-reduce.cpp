@@ -43,7 +43,13 @@ using TestingTypes = ::testing::Types<
     ,
     std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>, omp_reduce>,
     std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>,
-               omp_reduce_ordered>
+               omp_reduce_ordered>,
+    std::tuple<ExecPolicy<omp_parallel_for_dynamic<>, loop_exec>, omp_reduce>,
+    std::tuple<ExecPolicy<seq_segit, omp_parallel_for_dynamic<16>>,
+               omp_reduce>,
+    std::tuple<ExecPolicy<seq_segit, omp_parallel_for_guided<4>>, omp_reduce>,
+    std::tuple<ExecPolicy<omp_parallel_for_runtime, loop_exec>, omp_reduce>,
+    std::tuple<ExecPolicy<omp_balanced_segit, loop_exec>, omp_reduce>
 #endif
 #if defined(RAJA_ENABLE_TBB)
     ,
@@ -23,7 +23,9 @@
 #include "RAJA/RAJA.hpp"
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <cstring>
 #include <tuple>
+#include <vector>
 
 template <typename T>
 class ReductionConstructorTest : public ::testing::Test
@@ -502,3 +504,89 @@ INSTANTIATE_TYPED_TEST_CASE_P(NestedReduce,
                               NestedReductionCorrectnessTest,
                               nested_types);
 #endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ReduceOMP, OrderedSumIsReproducible)
+{
+  const int N = 100003;
+  std::vector<double> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = 1.0 / (1.0 + i % 97) + 1.0e-9 * i;
+  }
+  double* data = vals.data();
+
+  auto run = [=]() {
+    RAJA::ReduceSum<RAJA::omp_reduce_ordered, double> sum(0.5);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](int i) { sum += data[i]; });
+    return sum.get();
+  };
+
+  double first = run();
+  for (int rep = 0; rep < 5; ++rep) {
+    double again = run();
+    ASSERT_EQ(0, std::memcmp(&first, &again, sizeof(double)));
+  }
+}
+
+TEST(ReduceOMP, ThreadCountRaisedAfterConstruction)
+{
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+
+  RAJA::ReduceSum<RAJA::omp_reduce, int> sum(0);
+  RAJA::ReduceMaxLoc<RAJA::omp_reduce_ordered, int> maxloc(-1, -1);
+
+  omp_set_num_threads(max_threads + 3);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, 1000),
+                                            [=](int i) {
+                                              sum += i;
+                                              maxloc.maxloc(i % 500, i);
+                                            });
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQ(499500, sum.get());
+  ASSERT_EQ(499, maxloc.get());
+  ASSERT_EQ(499, maxloc.getLoc() % 500);
+}
+
+TEST(ReduceOMP, NestedParallelLoops)
+{
+  const int N = 64;
+  const int reps = 20;
+
+  using KPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::omp_parallel_for_exec,
+      RAJA::statement::For<1,
+                           RAJA::omp_parallel_for_exec,
+                           RAJA::statement::Lambda<0>>>>;
+
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  // thread ids repeat across the inner teams, so no update may be lost
+  for (int rep = 0; rep < reps; ++rep) {
+    RAJA::ReduceSum<RAJA::omp_reduce, int> sum(0);
+    RAJA::ReduceSum<RAJA::omp_reduce_ordered, int> osum(0);
+    RAJA::kernel<KPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                        RAJA::RangeSegment(0, N)),
+                       [=](int i, int j) {
+                         sum += 1;
+                         osum += i * N + j;
+                       });
+    ASSERT_EQ(N * N, sum.get());
+    ASSERT_EQ(N * N * (N * N - 1) / 2, osum.get());
+  }
+
+  RAJA::ReduceSum<RAJA::omp_reduce, int> sum(0);
+#pragma omp parallel
+  {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N * N),
+                                              [=](int) { sum += 1; });
+  }
+  ASSERT_EQ(N * N * omp_get_max_threads(), sum.get());
+
+  omp_set_num_threads(max_threads);
+}
+#endif
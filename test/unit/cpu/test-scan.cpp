@@ -22,6 +22,7 @@
 #include <random>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <cstdlib>
 
@@ -224,3 +225,34 @@ REGISTER_TYPED_TEST_CASE_P(Scan,
                            exclusive_inplace_offset);
 
 INSTANTIATE_TYPED_TEST_CASE_P(ScanTests, Scan, CrossTypes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ScanOMP, ManyChunks)
+{
+  // long enough that the single-pass scan spans many chunks
+  const int M = 3000001;
+  std::vector<long> data(M);
+  for (int i = 0; i < M; ++i) {
+    data[i] = (static_cast<long>(i) * 7919) % 13 - 6;
+  }
+  std::vector<long> out(M);
+
+  RAJA::inclusive_scan<RAJA::omp_parallel_for_exec>(data.data(),
+                                                    data.data() + M,
+                                                    out.data());
+  long agg = 0;
+  for (int i = 0; i < M; ++i) {
+    agg += data[i];
+    ASSERT_EQ(agg, out[i]);
+  }
+
+  std::vector<long> inplace(data);
+  RAJA::exclusive_scan_inplace<RAJA::omp_parallel_for_exec>(
+      inplace.data(), inplace.data() + M, RAJA::operators::plus<long>{}, 5L);
+  agg = 5;
+  for (int i = 0; i < M; ++i) {
+    ASSERT_EQ(agg, inplace[i]);
+    agg += data[i];
+  }
+}
+#endif
@@ -21,6 +21,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <vector>
 
 namespace RAJA
 {
@@ -426,6 +427,75 @@ TEST(SegmentTest, constructors)
   }
 }
 
+TEST(SegmentTest, list_shared_storage)
+{
+  RAJA::Index_type vals[5] = {4, 2, 9, 7, 1};
+  RAJA::ListSegment* first = new RAJA::ListSegment(vals, 5);
+  ASSERT_NE(vals, first->begin());
+
+  // copies share the indices, which live until the last copy is destroyed
+  RAJA::ListSegment copied(*first);
+  ASSERT_EQ(first->begin(), copied.begin());
+  delete first;
+  ASSERT_TRUE(copied.indicesEqual(vals, 5));
+
+  // a segment built from another's indices is a deep copy
+  RAJA::ListSegment deep(copied.begin(), copied.size());
+  ASSERT_NE(copied.begin(), deep.begin());
+  ASSERT_EQ(copied, deep);
+
+  // moving into an index set does not copy the indices
+  RAJA::Index_type* data = deep.begin();
+  RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+  iset.push_back(std::move(deep));
+  iset.push_back(copied);
+  ASSERT_EQ(data, iset.getSegment<RAJA::ListSegment>(0).begin());
+  ASSERT_EQ(copied.begin(), iset.getSegment<RAJA::ListSegment>(1).begin());
+  ASSERT_EQ(10lu, iset.getLength());
+}
+
+TEST(SegmentTest, list_slice)
+{
+  RAJA::Index_type vals[6] = {4, 2, 9, 7, 1, 8};
+  RAJA::ListSegment* list = new RAJA::ListSegment(vals, 6);
+
+  // slices share the indices of an owning segment
+  RAJA::ListSegment middle = list->slice(2, 3);
+  ASSERT_EQ(list->begin() + 2, middle.begin());
+  delete list;
+  ASSERT_TRUE(middle.indicesEqual(vals + 2, 3));
+
+  // slices stop at the end of the segment
+  RAJA::ListSegment tail = middle.slice(1, 10);
+  ASSERT_TRUE(tail.indicesEqual(vals + 3, 2));
+  ASSERT_EQ(0, middle.slice(5, 2).size());
+}
+
+TEST(SegmentTest, list_mempool)
+{
+  RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator> pool;
+  std::vector<RAJA::Index_type> vals(1000);
+  for (size_t i = 0; i < vals.size(); ++i) {
+    vals[i] = 3 * i;
+  }
+
+  RAJA::Index_type* data = nullptr;
+  {
+    RAJA::ListSegment seg(vals.data(), vals.size(), pool);
+    ASSERT_EQ(RAJA::Owned, seg.getIndexOwnership());
+    ASSERT_TRUE(seg.indicesEqual(vals.data(), vals.size()));
+    data = seg.begin();
+
+    RAJA::TypedIndexSet<RAJA::ListSegment> iset;
+    iset.push_back(seg);
+  }
+
+  // the indices went back to the pool with the last copy
+  RAJA::Index_type* reused = pool.malloc<RAJA::Index_type>(vals.size());
+  ASSERT_EQ(data, reused);
+  pool.free(reused);
+}
+
 TEST(SegmentTest, assignments)
 {
   {
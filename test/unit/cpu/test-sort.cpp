@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU sort operations.
+///
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+
+// large enough for the parallel backends to use several blocks
+const int N = 300007;
+
+template <typename T>
+class Sort : public ::testing::Test
+{
+protected:
+  template <typename Key>
+  std::vector<Key> random_keys(Key lo, Key hi)
+  {
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<long long> dist(lo, hi);
+    std::vector<Key> keys(N);
+    for (auto& k : keys) {
+      k = static_cast<Key>(dist(gen));
+    }
+    return keys;
+  }
+};
+
+TYPED_TEST_CASE_P(Sort);
+
+TYPED_TEST_P(Sort, sort_int)
+{
+  auto keys = this->template random_keys<int>(-1000000, 1000000);
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+
+  RAJA::sort<TypeParam>(keys);
+  ASSERT_EQ(expected, keys);
+}
+
+TYPED_TEST_P(Sort, sort_descending)
+{
+  auto keys = this->template random_keys<long>(-(1L << 40), 1L << 40);
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end(), std::greater<long>{});
+
+  RAJA::sort<TypeParam>(keys.begin(),
+                        keys.end(),
+                        RAJA::operators::greater<long>{});
+  ASSERT_EQ(expected, keys);
+}
+
+TYPED_TEST_P(Sort, sort_small_range)
+{
+  auto keys = this->template random_keys<unsigned short>(0, 3);
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+
+  RAJA::sort<TypeParam>(keys.data(), keys.data() + N);
+  ASSERT_EQ(expected, keys);
+}
+
+TYPED_TEST_P(Sort, sort_double)
+{
+  std::mt19937 gen(99);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> keys(N);
+  for (auto& k : keys) {
+    k = dist(gen);
+  }
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+
+  RAJA::sort<TypeParam>(keys);
+  ASSERT_EQ(expected, keys);
+}
+
+TYPED_TEST_P(Sort, stable_sort_custom_compare)
+{
+  // order by the high bits only, so many elements compare equal
+  auto keys = this->template random_keys<int>(0, 1 << 20);
+  auto by_high = [](int a, int b) { return (a >> 12) < (b >> 12); };
+  auto expected = keys;
+  std::stable_sort(expected.begin(), expected.end(), by_high);
+
+  RAJA::stable_sort<TypeParam>(keys.begin(), keys.end(), by_high);
+  ASSERT_EQ(expected, keys);
+}
+
+TYPED_TEST_P(Sort, sort_pairs_int)
+{
+  auto keys = this->template random_keys<int>(-100, 100);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = i;
+  }
+
+  std::vector<std::pair<int, int>> expected(N);
+  for (int i = 0; i < N; ++i) {
+    expected[i] = std::make_pair(keys[i], vals[i]);
+  }
+  std::stable_sort(expected.begin(),
+                   expected.end(),
+                   [](const std::pair<int, int>& a,
+                      const std::pair<int, int>& b) {
+                     return a.first < b.first;
+                   });
+
+  RAJA::stable_sort_pairs<TypeParam>(keys, vals);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(expected[i].first, keys[i]);
+    ASSERT_EQ(expected[i].second, vals[i]);
+  }
+}
+
+TYPED_TEST_P(Sort, sort_pairs_double)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  std::vector<double> keys(N);
+  std::vector<int> vals(N);
+  for (int i = 0; i < N; ++i) {
+    keys[i] = 0.5 * dist(gen);
+    vals[i] = i;
+  }
+  auto original = keys;
+
+  RAJA::sort_pairs<TypeParam>(keys.begin(), keys.end(), vals.begin());
+
+  ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  std::vector<bool> seen(N, false);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(original[vals[i]], keys[i]);
+    ASSERT_FALSE(seen[vals[i]]);
+    seen[vals[i]] = true;
+  }
+}
+
+TYPED_TEST_P(Sort, sort_short_ranges)
+{
+  for (int n : {0, 1, 2, 17}) {
+    auto keys = this->template random_keys<int>(-5, 5);
+    keys.resize(n);
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+    RAJA::sort<TypeParam>(keys);
+    ASSERT_EQ(expected, keys);
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(Sort,
+                           sort_int,
+                           sort_descending,
+                           sort_small_range,
+                           sort_double,
+                           stable_sort_custom_compare,
+                           sort_pairs_int,
+                           sort_pairs_double,
+                           sort_short_ranges);
+
+using SortTypes = ::testing::Types<RAJA::seq_exec,
+                                   RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                   ,
+                                   RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                   ,
+                                   RAJA::tbb_for_exec
+#endif
+                                   >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(CPU, Sort, SortTypes);
@@ -0,0 +1,369 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for dependency-graph ordered index set
+/// execution.
+///
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "RAJA_gtest.hpp"
+
+using ISet = RAJA::TypedIndexSet<RAJA::RangeSegment>;
+
+const int SEG_LEN = 100;
+
+TEST(DepGraph, FinalizeCountsPredecessors)
+{
+  RAJA::DepGraph graph(4);
+  graph.addDependency(0, 2);
+  graph.addDependency(1, 2);
+  graph.addDependency(2, 3);
+  graph.finalize();
+
+  ASSERT_EQ(0, graph[0].semaphoreReloadValue());
+  ASSERT_EQ(2, graph[2].semaphoreReloadValue());
+  ASSERT_EQ(1, graph[3].semaphoreReloadValue());
+  ASSERT_EQ(2u, graph.roots().size());
+
+  ASSERT_FALSE(graph[2].satisfyOne());
+  ASSERT_TRUE(graph[2].satisfyOne());
+
+  graph.reset();
+  ASSERT_EQ(2, graph[2].semaphoreValue().load());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Build num_seg segments of SEG_LEN indices; every segment records when its
+// first and last index ran so dependency order can be checked afterwards.
+static void check_order(ISet& iset,
+                        RAJA::DepGraph& graph,
+                        int num_seg,
+                        int repeats)
+{
+  std::vector<std::atomic<int>> start(num_seg);
+  std::vector<std::atomic<int>> finish(num_seg);
+  std::atomic<int> clock(0);
+  std::vector<int> count(num_seg * SEG_LEN);
+
+  for (int r = 0; r < repeats; ++r) {
+    for (auto& c : count) {
+      c = 0;
+    }
+
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+        iset, [&](RAJA::Index_type i) {
+          const int seg = static_cast<int>(i / SEG_LEN);
+          if (i % SEG_LEN == 0) start[seg] = clock++;
+          ++count[i];
+          if (i % SEG_LEN == SEG_LEN - 1) finish[seg] = clock++;
+        });
+
+    for (auto c : count) {
+      ASSERT_EQ(1, c);
+    }
+    for (int s = 0; s < num_seg; ++s) {
+      for (int jj = 0; jj < graph[s].numDepTasks(); ++jj) {
+        int dep = graph[s].depTaskNum(jj);
+        ASSERT_LT(finish[s].load(), start[dep].load());
+      }
+      // graph is ready for reuse once execution finishes
+      ASSERT_EQ(graph[s].semaphoreReloadValue(),
+                graph[s].semaphoreValue().load());
+    }
+  }
+}
+
+TEST(TaskGraph, Chain)
+{
+  const int num_seg = 32;
+  ISet iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * SEG_LEN, (s + 1) * SEG_LEN));
+  }
+  iset.initDependencyGraph();
+  RAJA::DepGraph& graph = iset.getDependencyGraph();
+  for (int s = 0; s + 1 < num_seg; ++s) {
+    graph.addDependency(s, s + 1);
+  }
+  iset.finalizeDependencyGraph();
+
+  check_order(iset, graph, num_seg, 3);
+}
+
+TEST(TaskGraph, WideFanOutFanIn)
+{
+  // one root with many more successors than the old fixed node capacity,
+  // all feeding a single sink
+  const int width = 40;
+  const int num_seg = width + 2;
+  ISet iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * SEG_LEN, (s + 1) * SEG_LEN));
+  }
+  iset.initDependencyGraph();
+  RAJA::DepGraph& graph = iset.getDependencyGraph();
+  for (int s = 1; s <= width; ++s) {
+    graph.addDependency(0, s);
+    graph.addDependency(s, num_seg - 1);
+  }
+  iset.finalizeDependencyGraph();
+
+  ASSERT_EQ(width, iset.getDepGraphNode(0)->numDepTasks());
+  check_order(iset, graph, num_seg, 4);
+}
+
+TEST(TaskGraph, Wavefront)
+{
+  // 2D sweep: segment (x, y) depends on (x - 1, y) and (x, y - 1)
+  const int nx = 8;
+  const int ny = 6;
+  ISet iset;
+  for (int s = 0; s < nx * ny; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * SEG_LEN, (s + 1) * SEG_LEN));
+  }
+  iset.initDependencyGraph();
+  RAJA::DepGraph& graph = iset.getDependencyGraph();
+  for (int y = 0; y < ny; ++y) {
+    for (int x = 0; x < nx; ++x) {
+      if (x + 1 < nx) graph.addDependency(y * nx + x, y * nx + x + 1);
+      if (y + 1 < ny) graph.addDependency(y * nx + x, (y + 1) * nx + x);
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  // copies share the graph
+  ISet copy(iset);
+  ASSERT_TRUE(copy.dependencyGraphSet());
+  check_order(copy, graph, nx * ny, 3);
+}
+
+TEST(TaskGraph, Intervals)
+{
+  const int num_seg = 12;
+  ISet iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * SEG_LEN, (s + 1) * SEG_LEN));
+  }
+  // three intervals of four segments each, executed back to back
+  for (int k = 0; k < 3; ++k) {
+    iset.setSegmentInterval(k, 4 * k, 4 * (k + 1));
+  }
+  iset.initDependencyGraph(3);
+  iset.getDependencyGraph().addDependency(0, 1);
+  iset.getDependencyGraph().addDependency(1, 2);
+  iset.finalizeDependencyGraph();
+
+  std::vector<int> order;
+  RAJA::forall<
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type i) { order.push_back(static_cast<int>(i)); });
+
+  ASSERT_EQ(num_seg * SEG_LEN, static_cast<int>(order.size()));
+  for (int i = 0; i < num_seg * SEG_LEN; ++i) {
+    ASSERT_EQ(i, order[i]);
+  }
+}
+
+TEST(TaskGraph, ReduceSum)
+{
+  const int num_seg = 16;
+  ISet iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RAJA::RangeSegment(s * SEG_LEN, (s + 1) * SEG_LEN));
+  }
+  iset.initDependencyGraph();
+  for (int s = 0; s + 2 < num_seg; ++s) {
+    iset.getDependencyGraph().addDependency(s, s + 2);
+  }
+  iset.finalizeDependencyGraph();
+
+  RAJA::ReduceSum<RAJA::omp_reduce, long> sum(0);
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type i) { sum += i; });
+
+  const long n = num_seg * SEG_LEN;
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+}
+
+using LockFreeISet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                         RAJA::ListSegment,
+                                         RAJA::RangeStrideSegment>;
+
+// Every pair of segments touching a common plane (a zone reaches one plane
+// to either side) must be ordered by a direct edge of the dependency graph.
+static void check_lockfree_blocks(LockFreeISet& iset,
+                                  RAJA::Index_type planeSize,
+                                  RAJA::Index_type numIndices)
+{
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  RAJA::DepGraph& graph = iset.getDependencyGraph();
+  const int num_seg = static_cast<int>(iset.getNumSegments());
+  ASSERT_EQ(num_seg, graph.size());
+  ASSERT_EQ(numIndices, static_cast<RAJA::Index_type>(iset.getLength()));
+
+  auto has_edge = [&](int a, int b) {
+    for (int jj = 0; jj < graph[a].numDepTasks(); ++jj) {
+      if (graph[a].depTaskNum(jj) == b) return true;
+    }
+    return false;
+  };
+
+  for (int a = 0; a < num_seg; ++a) {
+    const RAJA::RangeSegment& sa = iset.getSegment<RAJA::RangeSegment>(a);
+    ASSERT_EQ(0, *sa.begin() % planeSize);
+    ASSERT_EQ(0, *sa.end() % planeSize);
+    for (int b = a + 1; b < num_seg; ++b) {
+      const RAJA::RangeSegment& sb = iset.getSegment<RAJA::RangeSegment>(b);
+      RAJA::Index_type lo = std::max(*sa.begin(), *sb.begin()) / planeSize;
+      RAJA::Index_type hi = std::min(*sa.end(), *sb.end()) / planeSize;
+      if (lo <= hi + 1) {
+        ASSERT_TRUE(has_edge(a, b) || has_edge(b, a));
+      }
+    }
+  }
+}
+
+TEST(TaskGraph, LockFreeBlock3D)
+{
+  const int nx = 7;
+  const int ny = 5;
+  const int nz = 64;
+  const int plane = nx * ny;
+  const int num_zones = nx * ny * nz;
+
+  // the builder makes one slab per thread
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+  LockFreeISet iset;
+  RAJA::buildLockFreeBlockIndexset(iset, nx, ny, nz);
+  omp_set_num_threads(num_threads);
+  ASSERT_EQ(8u, iset.getNumSegments());
+  check_lockfree_blocks(iset, plane, num_zones);
+
+  // calls body(n) for the neighbors n of zone z in its 27 point stencil
+  auto neighbors = [=](RAJA::Index_type z, std::function<void(int)> body) {
+    const int i = static_cast<int>(z % nx);
+    const int j = static_cast<int>((z / nx) % ny);
+    const int k = static_cast<int>(z / plane);
+    for (int dk = -1; dk <= 1; ++dk) {
+      for (int dj = -1; dj <= 1; ++dj) {
+        for (int di = -1; di <= 1; ++di) {
+          const int ii = i + di, jj = j + dj, kk = k + dk;
+          if (ii < 0 || ii >= nx || jj < 0 || jj >= ny || kk < 0 || kk >= nz)
+            continue;
+          body((kk * ny + jj) * nx + ii);
+        }
+      }
+    }
+  };
+
+  // scatter every zone into its neighbors without atomics; any two
+  // segments running together on a shared plane would lose updates
+  auto scatter = [=](long* node, RAJA::Index_type z) {
+    neighbors(z, [=](int n) { node[n] = node[n] + z + 1; });
+  };
+
+  std::vector<long> expected(num_zones, 0);
+  for (int z = 0; z < num_zones; ++z) {
+    scatter(expected.data(), z);
+  }
+
+  std::vector<long> actual(num_zones);
+  for (int r = 0; r < 10; ++r) {
+    std::fill(actual.begin(), actual.end(), 0);
+    long* node = actual.data();
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type z) { scatter(node, z); });
+    ASSERT_EQ(expected, actual);
+  }
+
+  // Gauss-Seidel sweep: each zone reads neighbors already updated in the
+  // sweep, so the result depends on the order. The graph gives the result
+  // of running the segments in order, as seq_segit does.
+  auto relax = [=](double* u, RAJA::Index_type z) {
+    double sum = 0.0;
+    int count = 0;
+    neighbors(z, [&](int n) {
+      sum += u[n];
+      ++count;
+    });
+    u[z] = 0.5 * u[z] + 0.5 * sum / count + 1.0;
+  };
+
+  std::vector<double> init(num_zones);
+  for (int z = 0; z < num_zones; ++z) {
+    init[z] = (z * 37) % 101;
+  }
+
+  std::vector<double> serial(init);
+  double* us = serial.data();
+  for (int r = 0; r < 3; ++r) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type z) { relax(us, z); });
+  }
+
+  std::vector<double> graph(init);
+  double* ug = graph.data();
+  for (int r = 0; r < 3; ++r) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+        iset, [=](RAJA::Index_type z) { relax(ug, z); });
+  }
+  ASSERT_EQ(serial, graph);
+
+  // segments run lane by lane, not in lexical zone order
+  std::vector<double> lexical(init);
+  for (int r = 0; r < 3; ++r) {
+    for (int z = 0; z < num_zones; ++z) {
+      relax(lexical.data(), z);
+    }
+  }
+  EXPECT_NE(lexical, graph);
+}
+
+TEST(TaskGraph, LockFreeBlockLowDim)
+{
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+  LockFreeISet iset2d;
+  RAJA::buildLockFreeBlockIndexset(iset2d, 10, 100, 0);
+  LockFreeISet iset1d;
+  RAJA::buildLockFreeBlockIndexset(iset1d, 5000, 0, 0);
+  // too few planes to split: one segment, still runnable as a task graph
+  LockFreeISet small;
+  RAJA::buildLockFreeBlockIndexset(small, 4, 4, 3);
+  omp_set_num_threads(num_threads);
+
+  ASSERT_EQ(8u, iset2d.getNumSegments());
+  check_lockfree_blocks(iset2d, 10, 1000);
+  ASSERT_EQ(8u, iset1d.getNumSegments());
+  check_lockfree_blocks(iset1d, 1, 5000);
+  ASSERT_EQ(1u, small.getNumSegments());
+
+  long count = 0;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      small, [&](RAJA::Index_type) { ++count; });
+  ASSERT_EQ(48, count);
+}
+
+#endif
@@ -17,6 +17,8 @@
 /// Source file containing tests for atomic operations
 ///
 
+#include <vector>
+
 #include <RAJA/RAJA.hpp>
 #include "RAJA_gtest.hpp"
 
@@ -357,6 +359,8 @@ TEST(Atomic, basic_OpenMP_AtomicView)
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::auto_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::omp_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicViewPol<RAJA::omp_for_exec,
+                    RAJA::atomic::privatized_atomic<RAJA::atomic::omp_atomic>>();
 }
 
 
@@ -367,6 +371,124 @@ TEST(Atomic, basic_OpenMP_Logical)
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
 }
 
+// all threads update a few hot slots, with values of both signs
+template <typename AtomicPolicy, typename T>
+void testAtomicContended()
+{
+  constexpr RAJA::Index_type N = 100000;
+  constexpr int slots = 4;
+  T sum[slots] = {};
+  T min[slots];
+  T max[slots];
+  for (int s = 0; s < slots; ++s) {
+    min[s] = (T)0;
+    max[s] = (T)0;
+  }
+
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, N), [&](RAJA::Index_type i) {
+        const int s = i % slots;
+        const T v = (T)(i % 2 ? i : -i);
+        RAJA::atomic::atomicAdd<AtomicPolicy>(sum + s, (T)1);
+        RAJA::atomic::atomicSub<AtomicPolicy>(sum + s, (T)2);
+        RAJA::atomic::atomicMin<AtomicPolicy>(min + s, v);
+        RAJA::atomic::atomicMax<AtomicPolicy>(max + s, v);
+      });
+
+  for (int s = 0; s < slots; ++s) {
+    EXPECT_EQ(-(T)(N / slots), sum[s]);
+  }
+  // odd slots only see positive values, even slots only negative ones
+  EXPECT_EQ((T)(-(N - 4)), min[0]);
+  EXPECT_EQ((T)0, max[0]);
+  EXPECT_EQ((T)0, min[1]);
+  EXPECT_EQ((T)(N - 3), max[1]);
+  EXPECT_EQ((T)(-(N - 2)), min[2]);
+  EXPECT_EQ((T)0, max[2]);
+  EXPECT_EQ((T)0, min[3]);
+  EXPECT_EQ((T)(N - 1), max[3]);
+}
+
+template <typename AtomicPolicy>
+void testAtomicContendedPol()
+{
+  testAtomicContended<AtomicPolicy, int>();
+  testAtomicContended<AtomicPolicy, long long>();
+  testAtomicContended<AtomicPolicy, float>();
+  testAtomicContended<AtomicPolicy, double>();
+}
+
+// scatter-add from elements onto their two nodes, as in a 1D mesh
+template <typename ExecPolicy, typename AtomicPolicy, typename T>
+void testPrivatizedAtomicView()
+{
+  constexpr RAJA::Index_type N = 10000;
+  std::vector<T> nodes(N + 1, T(1));
+  RAJA::View<T, RAJA::Layout<1>> node_view(nodes.data(), N + 1);
+  auto atomic_nodes = RAJA::make_atomic_view<AtomicPolicy>(node_view);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type e) {
+    atomic_nodes(e) += (T)(e % 8);
+    atomic_nodes(e + 1) += (T)(e % 8);
+    atomic_nodes(e + 1) -= (T)1;
+  });
+
+  EXPECT_EQ((T)1, nodes[0]);
+  for (RAJA::Index_type i = 1; i < N; ++i) {
+    ASSERT_EQ((T)((i - 1) % 8 + i % 8), nodes[i]);
+  }
+  EXPECT_EQ((T)((N - 1) % 8), nodes[N]);
+
+  // the original view applies updates directly, copies on flush
+  atomic_nodes(0) += (T)2;
+  EXPECT_EQ((T)3, nodes[0]);
+  auto copy = atomic_nodes;
+  copy(0) += (T)2;
+  copy(0) += (T)2;
+  copy.flush();
+  EXPECT_EQ((T)7, nodes[0]);
+  copy(0) += (T)1;
+  EXPECT_EQ((T)8, (T)copy(0));
+}
+
+template <typename ExecPolicy, typename T>
+void testPrivatizedAtomicViewSizes()
+{
+  using RAJA::atomic::privatized_atomic;
+  using RAJA::atomic::auto_atomic;
+  testPrivatizedAtomicView<ExecPolicy, privatized_atomic<>, T>();
+  testPrivatizedAtomicView<ExecPolicy, privatized_atomic<auto_atomic, 4>, T>();
+  testPrivatizedAtomicView<ExecPolicy, privatized_atomic<auto_atomic, 0>, T>();
+}
+
+TEST(Atomic, privatized_OpenMP_AtomicView)
+{
+  testPrivatizedAtomicViewSizes<RAJA::omp_parallel_for_exec, int>();
+  testPrivatizedAtomicViewSizes<RAJA::omp_parallel_for_exec, unsigned>();
+  testPrivatizedAtomicViewSizes<RAJA::omp_parallel_for_exec, double>();
+}
+
+TEST(Atomic, contended_OpenMP)
+{
+  testAtomicContendedPol<RAJA::atomic::auto_atomic>();
+  testAtomicContendedPol<RAJA::atomic::omp_atomic>();
+  testAtomicContendedPol<RAJA::atomic::builtin_atomic>();
+}
+
+TEST(Atomic, long_double_OpenMP)
+{
+  // wider than the builtin CAS loops, so add and sub stay on omp atomic
+  constexpr RAJA::Index_type N = 10000;
+  long double sum = 0.0L;
+  long double* psum = &sum;
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, N), [=](RAJA::Index_type) {
+        RAJA::atomic::atomicAdd<RAJA::atomic::omp_atomic>(psum, 3.0L);
+        RAJA::atomic::atomicSub<RAJA::atomic::omp_atomic>(psum, 1.0L);
+      });
+  EXPECT_EQ(2.0L * N, sum);
+}
+
 #endif
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -418,9 +540,16 @@ TEST(Atomic, basic_seq_AtomicView)
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::privatized_atomic<>>();
 }
 
 
+TEST(Atomic, privatized_seq_AtomicView)
+{
+  testPrivatizedAtomicViewSizes<RAJA::seq_exec, int>();
+  testPrivatizedAtomicViewSizes<RAJA::seq_exec, double>();
+}
+
 TEST(Atomic, basic_seq_Logical)
 {
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
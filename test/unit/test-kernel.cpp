@@ -16,7 +16,9 @@
 #include "RAJA/RAJA.hpp"
 #include "RAJA_gtest.hpp"
 
+#include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #if defined(RAJA_ENABLE_CUDA)
 #include <cuda_runtime.h>
@@ -281,6 +283,18 @@ using OMPTypes = ::testing::Types<
                              RAJA::omp_parallel_for_exec,
                              For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
          list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_parallel_for_dynamic<2>, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_parallel_for_guided<>, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
+         RAJA::omp_reduce>,
+    list<KernelPolicy<
+             For<1, RAJA::omp_parallel_for_runtime, For<0, s, Lambda<0>>>>,
+         list<TypedIndex, Index_type>,
          RAJA::omp_reduce>>;
 INSTANTIATE_TYPED_TEST_CASE_P(OpenMP, Kernel, OMPTypes);
 #endif
@@ -667,6 +681,182 @@ TEST(Kernel, Shmem1)
 }
 
 
+// each tile is loaded into shmem, then read back in reverse, so any
+// sharing of the buffer between threads shows up in the result
+template <typename TilePol>
+void runThreadShmemTest()
+{
+  using namespace RAJA;
+
+  constexpr int TileSize = 32;
+  using Pol = KernelPolicy<
+      statement::Tile<0,
+                      statement::tile_fixed<TileSize>,
+                      TilePol,
+                      SetShmemWindow<For<0, seq_exec, Lambda<0>>,
+                                     For<0, seq_exec, Lambda<1>>>>>;
+
+  constexpr int N = 64 * 1024;
+  int *x = new int[N];
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0;
+  }
+
+  auto loop_segments = RAJA::make_tuple(RangeSegment(0, N));
+
+  using shmem_t = ShmemTile<cpu_thread_shmem,
+                            int,
+                            ArgList<0>,
+                            SizeList<TileSize>,
+                            decltype(loop_segments)>;
+  shmem_t shmem;
+
+  for (int rep = 0; rep < 3; ++rep) {
+    kernel_param<Pol>(
+
+        loop_segments,
+
+        RAJA::make_tuple(shmem),
+
+        [=](int i, shmem_t &sh) { sh(i) = i + rep; },
+        [=](int i, shmem_t &sh) {
+          int tile = i - i % TileSize;
+          x[i] = sh(tile + TileSize - 1 - i % TileSize);
+        });
+
+    for (int i = 0; i < N; ++i) {
+      int tile = i - i % TileSize;
+      ASSERT_EQ(x[i], tile + TileSize - 1 - i % TileSize + rep);
+    }
+  }
+
+  delete[] x;
+}
+
+TEST(Kernel, ThreadShmemSeq) { runThreadShmemTest<RAJA::seq_exec>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, ThreadShmemOpenMP)
+{
+  runThreadShmemTest<RAJA::omp_parallel_for_exec>();
+}
+
+TEST(Kernel, ThreadShmemBuffers)
+{
+  using shmem_t = RAJA::SharedMemory<RAJA::cpu_thread_shmem, double, 5>;
+  shmem_t shmem;
+
+  const int nthreads = omp_get_max_threads();
+  std::vector<double *> bufs(nthreads, nullptr);
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    shmem_t priv(shmem);
+    shmem_t inner(priv);
+    // copies on one thread share its buffer
+    if (inner.data == priv.data) {
+      bufs[omp_get_thread_num()] = priv.data;
+    }
+  }
+
+  for (int t = 0; t < nthreads; ++t) {
+    ASSERT_NE(bufs[t], nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(bufs[t]) % RAJA::CACHE_LINE_SIZE,
+              0u);
+    for (int u = 0; u < t; ++u) {
+      ASSERT_NE(bufs[t], bufs[u]);
+    }
+  }
+}
+
+TEST(Kernel, ThreadShmemNestedBuffers)
+{
+  using shmem_t = RAJA::SharedMemory<RAJA::cpu_thread_shmem, double, 5>;
+  shmem_t shmem;
+
+  const int max_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(2);
+  std::vector<double *> bufs(4, nullptr);
+
+  // thread ids repeat across the inner teams, so their copies must not
+  // share a thread's buffer
+#pragma omp parallel num_threads(2)
+  {
+    const int outer = omp_get_thread_num();
+    shmem_t priv(shmem);
+#pragma omp parallel num_threads(2)
+    {
+      shmem_t nested(priv);
+      shmem_t inner(nested);
+      if (inner.data == nested.data && nested.data != priv.data) {
+        bufs[2 * outer + omp_get_thread_num()] = nested.data;
+      }
+#pragma omp barrier
+    }
+  }
+  omp_set_max_active_levels(max_levels);
+
+  for (int t = 0; t < 4; ++t) {
+    ASSERT_NE(bufs[t], nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(bufs[t]) % RAJA::CACHE_LINE_SIZE,
+              0u);
+  }
+}
+
+TEST(Kernel, ThreadShmemNestedOpenMP)
+{
+  using namespace RAJA;
+
+  constexpr int TileSize = 32;
+  using Pol = KernelPolicy<For<
+      1,
+      omp_parallel_for_exec,
+      statement::Tile<0,
+                      statement::tile_fixed<TileSize>,
+                      omp_parallel_for_exec,
+                      SetShmemWindow<For<0, seq_exec, Lambda<0>>,
+                                     For<0, seq_exec, Lambda<1>>>>>>;
+
+  constexpr int N = 4 * 1024;
+  constexpr int M = 8;
+  int *x = new int[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    x[i] = 0;
+  }
+
+  auto loop_segments = RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M));
+
+  using shmem_t = ShmemTile<cpu_thread_shmem,
+                            int,
+                            ArgList<0>,
+                            SizeList<TileSize>,
+                            decltype(loop_segments)>;
+  shmem_t shmem;
+
+  kernel_param<Pol>(
+
+      loop_segments,
+
+      RAJA::make_tuple(shmem),
+
+      [=](int i, int j, shmem_t &sh) { sh(i) = i + j * N; },
+      [=](int i, int j, shmem_t &sh) {
+        int tile = i - i % TileSize;
+        x[i + j * N] = sh(tile + TileSize - 1 - i % TileSize);
+      });
+
+  for (int j = 0; j < M; ++j) {
+    for (int i = 0; i < N; ++i) {
+      int tile = i - i % TileSize;
+      ASSERT_EQ(x[i + j * N], tile + TileSize - 1 - i % TileSize + j * N);
+    }
+  }
+
+  delete[] x;
+}
+#endif
+
+
 TEST(Kernel, FissionFusion)
 {
   using namespace RAJA;
@@ -793,6 +983,48 @@ TEST(Kernel, Tile)
 }
 
 
+TEST(Kernel, TileCache)
+{
+  using namespace RAJA;
+
+  // 2d tiles of a transpose sized for the L1 cache
+  using TPol = statement::tile_cache<2 * sizeof(double), 2, 1>;
+  using Pol = KernelPolicy<
+      statement::Tile<
+          1,
+          TPol,
+          seq_exec,
+          statement::Tile<0,
+                          TPol,
+                          seq_exec,
+                          For<1, seq_exec, For<0, seq_exec, Lambda<0>>>>>>;
+
+  const Index_type tile = RAJA::internal::TileSize<TPol>::get();
+  ASSERT_GE(tile, 1);
+  ASSERT_LE(tile * tile * 2 * sizeof(double), getCacheSize(1));
+
+  // not a multiple of the tile size
+  const int N = 3 * tile + 5;
+  std::vector<double> a(N * N), b(N * N, -1.0);
+  for (int i = 0; i < N * N; ++i) {
+    a[i] = i;
+  }
+  double *pa = a.data();
+  double *pb = b.data();
+
+  kernel<Pol>(RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, N)),
+              [=](Index_type i, Index_type j) {
+                pb[j * N + i] = pa[i * N + j];
+              });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      ASSERT_EQ(b[j * N + i], a[i * N + j]);
+    }
+  }
+}
+
+
 TEST(Kernel, CollapseSeq)
 {
   using namespace RAJA;
@@ -1092,6 +1324,111 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+template <typename CollapsePol>
+void testCollapse4Dims()
+{
+  int N = 3;
+  int M = 5;
+  int K = 4;
+  int P = 7;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<CollapsePol, ArgList<0, 1, 2, 3>, Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(2, K + 2),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(1, N + 1),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * ((i - 1) + N * (j + M * (k - 2)));
+        data[id] += id + 1;
+      });
+
+  for (int id = 0; id < N * M * K * P; ++id) {
+    ASSERT_EQ(data[id], id + 1);
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse9)
+{
+  testCollapse4Dims<RAJA::omp_parallel_collapse_exec>();
+  testCollapse4Dims<RAJA::omp_parallel_collapse_static<1>>();
+  testCollapse4Dims<RAJA::omp_parallel_collapse_static<16>>();
+  testCollapse4Dims<RAJA::omp_parallel_collapse_dynamic<1>>();
+  testCollapse4Dims<RAJA::omp_parallel_collapse_dynamic<8>>();
+}
+
+TEST(Kernel, Collapse10)
+{
+  int N = 2;
+  int M = 3;
+  int K = 4;
+  int P = 5;
+  int Q = 3;
+
+  int *data = new int[N * M * K * P * Q];
+  for (int i = 0; i < N * M * K * P * Q; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_dynamic<4>,
+                                ArgList<0, 1, 2, 3>,
+                                For<4, RAJA::seq_exec, Lambda<0>>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                     RAJA::RangeSegment(0, M),
+                                     RAJA::RangeSegment(0, K),
+                                     RAJA::RangeSegment(0, P),
+                                     RAJA::RangeSegment(0, Q)),
+                    [=](Index_type n,
+                        Index_type m,
+                        Index_type k,
+                        Index_type p,
+                        Index_type q) {
+                      Index_type id = q + Q * (p + P * (k + K * (m + M * n)));
+                      data[id] += id;
+                    });
+
+  for (int id = 0; id < N * M * K * P * Q; ++id) {
+    ASSERT_EQ(data[id], id);
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse11)
+{
+  int count = 0;
+  int *pcount = &count;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_static<2>,
+                                ArgList<0, 1, 2, 3, 4>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 3),
+                                     RAJA::RangeSegment(0, 2),
+                                     RAJA::RangeSegment(0, 0),
+                                     RAJA::RangeSegment(0, 4),
+                                     RAJA::RangeSegment(0, 2)),
+                    [=](Index_type, Index_type, Index_type, Index_type,
+                        Index_type) {
+#pragma omp atomic
+                      ++*pcount;
+                    });
+
+  ASSERT_EQ(count, 0);
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -1876,6 +2213,105 @@ TEST(Kernel, Hyperplane_seq)
 }
 
 
+// 3d sweep where each point depends on its lower neighbors in every index;
+// only correct if hyperplanes run in order, and counts visits per point
+template <typename Pol>
+void runHyperplaneSweep3d(int Ni, int Nj, int Nk)
+{
+  using namespace RAJA;
+
+  std::vector<long> a(Ni * Nj * Nk, 0), expected(Ni * Nj * Nk, 0);
+  std::vector<int> visits(Ni * Nj * Nk, 0);
+  long *pa = a.data();
+  int *pv = visits.data();
+
+  auto at = [=](int i, int j, int k) { return (i * Nj + j) * Nk + k; };
+
+  for (int i = 0; i < Ni; ++i) {
+    for (int j = 0; j < Nj; ++j) {
+      for (int k = 0; k < Nk; ++k) {
+        long v = i + 2 * j + 3 * k;
+        if (i > 0) v += expected[at(i - 1, j, k)] % 1000;
+        if (j > 0) v += expected[at(i, j - 1, k)] % 1000;
+        if (k > 0) v += expected[at(i, j, k - 1)] % 1000;
+        expected[at(i, j, k)] = v;
+      }
+    }
+  }
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(TypedRangeSegment<int>(0, Ni),
+                       TypedRangeSegment<int>(0, Nj),
+                       TypedRangeSegment<int>(0, Nk)),
+
+      [=](int i, int j, int k) {
+        long v = i + 2 * j + 3 * k;
+        if (i > 0) v += pa[at(i - 1, j, k)] % 1000;
+        if (j > 0) v += pa[at(i, j - 1, k)] % 1000;
+        if (k > 0) v += pa[at(i, j, k - 1)] % 1000;
+        pa[at(i, j, k)] = v;
+        pv[at(i, j, k)] += 1;
+      });
+
+  for (int n = 0; n < Ni * Nj * Nk; ++n) {
+    ASSERT_EQ(visits[n], 1);
+    ASSERT_EQ(a[n], expected[n]);
+  }
+}
+
+template <typename ExecPol>
+void runHyperplaneSweeps()
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Hyperplane<0, seq_exec, ArgList<1, 2>, ExecPol, Lambda<0>>>;
+  using PolLast = KernelPolicy<
+      Hyperplane<2, seq_exec, ArgList<0, 1>, ExecPol, Lambda<0>>>;
+  using PolBlocked = KernelPolicy<
+      BlockedHyperplane<0, 4, seq_exec, ArgList<1, 2>, ExecPol, Lambda<0>>>;
+
+  runHyperplaneSweep3d<Pol>(9, 9, 9);
+  runHyperplaneSweep3d<Pol>(3, 17, 6);
+  runHyperplaneSweep3d<Pol>(1, 5, 1);
+  runHyperplaneSweep3d<PolLast>(11, 4, 7);
+  runHyperplaneSweep3d<PolBlocked>(9, 9, 9);
+  runHyperplaneSweep3d<PolBlocked>(13, 3, 10);
+  runHyperplaneSweep3d<PolBlocked>(2, 2, 2);
+}
+
+TEST(Kernel, Hyperplane_seq_3d) { runHyperplaneSweeps<RAJA::seq_exec>(); }
+
+TEST(Kernel, Hyperplane_empty)
+{
+  using namespace RAJA;
+
+  using Pol =
+      KernelPolicy<Hyperplane<0, seq_exec, ArgList<1>, seq_exec, Lambda<0>>>;
+
+  int count = 0;
+  kernel<Pol>(RAJA::make_tuple(TypedRangeSegment<int>(0, 5),
+                               TypedRangeSegment<int>(0, 0)),
+              [&](int, int) { ++count; });
+  ASSERT_EQ(count, 0);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, Hyperplane_omp_3d)
+{
+  runHyperplaneSweeps<RAJA::omp_parallel_for_exec>();
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(Kernel, Hyperplane_tbb_3d)
+{
+  runHyperplaneSweeps<RAJA::tbb_for_dynamic>();
+}
+#endif
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
 
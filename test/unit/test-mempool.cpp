@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for basic_mempool memory pools
+///
+
+#include <cstdint>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA_gtest.hpp"
+
+template <typename Pool>
+class MemPoolTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(MemPoolTest);
+
+TYPED_TEST_P(MemPoolTest, MallocFreeAlignment)
+{
+  TypeParam pool;
+
+  double* d = pool.template malloc<double>(100);
+  ASSERT_NE(nullptr, d);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(d) % alignof(double));
+  for (int i = 0; i < 100; ++i) {
+    d[i] = i;
+  }
+
+  char* c = pool.template malloc<char>(3, 256);
+  ASSERT_NE(nullptr, c);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(c) % 256);
+
+  // the two allocations do not overlap
+  ASSERT_TRUE(c + 3 <= reinterpret_cast<char*>(d)
+              || reinterpret_cast<char*>(d + 100) <= c);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(double(i), d[i]);
+  }
+
+  pool.free(c);
+  pool.free(d);
+  pool.free_chunks();
+}
+
+TYPED_TEST_P(MemPoolTest, LargeAllocations)
+{
+  TypeParam pool;
+  pool.arena_size(1024 * 1024);
+  ASSERT_EQ(1024u * 1024u, pool.arena_size());
+
+  // larger than an arena
+  const size_t n = 3 * 1024 * 1024;
+  int* a = pool.template malloc<int>(n);
+  ASSERT_NE(nullptr, a);
+  a[0] = 1;
+  a[n - 1] = 2;
+  int* b = pool.template malloc<int>(16);
+  ASSERT_NE(nullptr, b);
+  ASSERT_TRUE(b + 16 <= a || a + n <= b);
+  pool.free(a);
+  pool.free(b);
+
+  // freed memory is handed out again
+  int* c = pool.template malloc<int>(n);
+  ASSERT_NE(nullptr, c);
+  pool.free(c);
+  pool.free_chunks();
+}
+
+TYPED_TEST_P(MemPoolTest, ManyAllocations)
+{
+  TypeParam pool;
+  std::vector<long*> ptrs;
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < 5000; ++i) {
+      long* p = pool.template malloc<long>(1 + i % 300);
+      ASSERT_NE(nullptr, p);
+      p[0] = i;
+      p[i % 300] = i;
+      ptrs.push_back(p);
+    }
+    for (int i = 0; i < 5000; ++i) {
+      ASSERT_EQ(i, ptrs[i][0]);
+      ASSERT_EQ(i, ptrs[i][i % 300]);
+    }
+    for (long* p : ptrs) {
+      pool.free(p);
+    }
+    ptrs.clear();
+  }
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TYPED_TEST_P(MemPoolTest, ConcurrentMallocFree)
+{
+  TypeParam pool;
+  int failures = 0;
+
+#pragma omp parallel reduction(+ : failures)
+  {
+    const int tid = omp_get_thread_num();
+    std::vector<int*> mine;
+    for (int r = 0; r < 200; ++r) {
+      for (int i = 0; i < 20; ++i) {
+        const int n = 1 + (r * 7 + i * 13) % 500;
+        int* p = pool.template malloc<int>(n);
+        for (int j = 0; j < n; ++j) {
+          p[j] = tid;
+        }
+        mine.push_back(p);
+      }
+      // keep every other allocation alive across rounds
+      for (size_t i = 0; i < mine.size(); ++i) {
+        if (mine[i][0] != tid) ++failures;
+      }
+      while (mine.size() > 10) {
+        pool.free(mine.back());
+        mine.pop_back();
+      }
+    }
+    for (int* p : mine) {
+      pool.free(p);
+    }
+  }
+
+  ASSERT_EQ(0, failures);
+  pool.free_chunks();
+}
+#endif
+
+REGISTER_TYPED_TEST_CASE_P(MemPoolTest,
+                           MallocFreeAlignment,
+                           LargeAllocations,
+                           ManyAllocations
+#if defined(RAJA_ENABLE_OPENMP)
+                           ,
+                           ConcurrentMallocFree
+#endif
+                           );
+
+using MemPoolTypes = ::testing::Types<
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>,
+    RAJA::basic_mempool::SizeClassMemPool<
+        RAJA::basic_mempool::generic_allocator>>;
+
+INSTANTIATE_TYPED_TEST_CASE_P(Pools, MemPoolTest, MemPoolTypes);
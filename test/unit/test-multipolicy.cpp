@@ -17,7 +17,12 @@
 /// Source file containing tests for basic multipolicy operation
 ///
 
+#include <chrono>
 #include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 
 // Tag type to dispatch to test bodies based on policy selected by multipolicy
@@ -60,7 +65,29 @@ void forall_impl(const mp_tag<i> &p, Iterable &&iter, mp_test_body const &body)
 }
 }  // namespace test_policy
 
+namespace test_policy
+{
+// mock policy that takes extra time for iteration spaces at least as long
+// as SlowFrom, or shorter than SlowBelow
+template <int SlowFrom, int SlowBelow = 0>
+struct slow_tag {
+};
+
+template <int SlowFrom, int SlowBelow, typename Iterable, typename Body>
+void forall_impl(const slow_tag<SlowFrom, SlowBelow> &,
+                 Iterable &&iter,
+                 Body &&body)
+{
+  int size = iter.size();
+  if (size >= SlowFrom || size < SlowBelow) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  body(size);
+}
+}  // namespace test_policy
+
 using test_policy::mp_tag;
+using test_policy::slow_tag;
 
 // NOTE: this *must* be after the above to work
 #include "RAJA/RAJA.hpp"
@@ -109,3 +136,100 @@ TEST(MultiPolicy, invalid_index)
       });
   ASSERT_THROW(make_invalid_index_throw(mp, seg), std::runtime_error);
 }
+
+TEST(MultiPolicy, select_once)
+{
+  int calls = 0;
+  auto mp = RAJA::make_multi_policy<RAJA::seq_exec, RAJA::seq_exec>(
+      [&calls](const RAJA::RangeSegment &) {
+        ++calls;
+        return 1;
+      });
+  ASSERT_EQ(mp.invoke(RAJA::RangeSegment(0, 10), [](RAJA::Index_type) {}), 1);
+  ASSERT_EQ(calls, 1);
+  RAJA::forall(mp, RAJA::RangeSegment(0, 10), [](RAJA::Index_type) {});
+  ASSERT_EQ(calls, 2);
+}
+
+TEST(MultiPolicy, autotune_picks_fastest)
+{
+  // policy 0 is slow from 100 iterations on, policy 1 below 100; copies
+  // of a selector share their timings
+  RAJA::AutotuneSelector sel("autotune_picks_fastest", 2);
+  auto mp =
+      RAJA::make_multi_policy<slow_tag<100>, slow_tag<1 << 30, 100>>(sel);
+
+  std::vector<int> used;
+  auto body = [&used](int size) { used.push_back(size); };
+  for (int i = 0; i < 6; ++i) {
+    RAJA::forall(mp, RAJA::RangeSegment(0, 10), body);
+    RAJA::forall(mp, RAJA::RangeSegment(0, 1000), body);
+  }
+  ASSERT_EQ(used.size(), 12u);
+
+  // each candidate ran 3 times in each bucket, then one was chosen
+  ASSERT_EQ(sel.chosen(10), 0);
+  ASSERT_EQ(sel.chosen(1000), 1);
+  ASSERT_EQ(sel.chosen(15), 0);
+  ASSERT_EQ(sel.chosen(100000), -1);
+
+  ASSERT_EQ(mp.invoke(RAJA::RangeSegment(0, 12), body), 0);
+  ASSERT_EQ(mp.invoke(RAJA::RangeSegment(0, 700), body), 1);
+}
+
+TEST(MultiPolicy, autotune_policy)
+{
+  auto mp = RAJA::make_autotune_policy<RAJA::seq_exec, RAJA::loop_exec>(
+      "autotune_policy");
+  int sum = 0;
+  for (int i = 0; i < 10; ++i) {
+    RAJA::forall(mp, RAJA::RangeSegment(0, 100), [&sum](int j) { sum += j; });
+  }
+  ASSERT_EQ(sum, 10 * 4950);
+}
+
+TEST(MultiPolicy, autotune_round_robin)
+{
+  RAJA::AutotuneSelector sel("autotune_round_robin", 3, "", 2);
+  std::vector<int> order;
+  for (int i = 0; i < 6; ++i) {
+    int p = sel.select(64);
+    order.push_back(p);
+    sel.record(64, p, p == 2 ? 1.0 : 2.0);
+  }
+  ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 0, 1, 2}));
+  ASSERT_EQ(sel.chosen(64), 2);
+  ASSERT_EQ(sel.select(100), 2);
+  ASSERT_EQ(sel.chosen(32), -1);
+}
+
+TEST(MultiPolicy, autotune_persists)
+{
+  const std::string file = "raja-test-autotune.txt";
+  std::remove(file.c_str());
+
+  {
+    RAJA::AutotuneSelector sel("site a", 2, file, 1);
+    sel.record(10, 0, 2.0);
+    sel.record(10, 1, 1.0);
+    ASSERT_EQ(sel.chosen(10), 1);
+
+    RAJA::AutotuneSelector other("site b", 2, file, 1);
+    other.record(1000, 0, 1.0);
+    other.record(1000, 1, 2.0);
+    ASSERT_EQ(other.chosen(1000), 0);
+  }
+
+  // choices of both sites are loaded again, without any timed runs
+  RAJA::AutotuneSelector a("site a", 2, file);
+  RAJA::AutotuneSelector b("site b", 2, file);
+  ASSERT_EQ(a.chosen(12), 1);
+  ASSERT_EQ(a.chosen(1000), -1);
+  ASSERT_EQ(b.chosen(1000), 0);
+
+  // a different number of candidates tunes again
+  RAJA::AutotuneSelector c("site a", 3, file);
+  ASSERT_EQ(c.chosen(12), -1);
+
+  std::remove(file.c_str());
+}
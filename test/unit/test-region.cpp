@@ -62,3 +62,177 @@ TEST(Region, basic_Functions)
   testRegionPol<RAJA::omp_parallel_region, RAJA::omp_for_exec>();
 #endif
 }
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Region, fused_parallel_loops)
+{
+  const int N = 10000;
+  int *A = new int[N];
+  int *B = new int[N];
+  for (int i = 0; i < N; ++i) {
+    A[i] = 0;
+    B[i] = 0;
+  }
+
+  using KPol = RAJA::KernelPolicy<
+      RAJA::statement::For<0,
+                           RAJA::omp_parallel_for_exec,
+                           RAJA::statement::Lambda<0>>>;
+
+  RAJA::region<RAJA::omp_fused_region>([=]() {
+    // each loop is shared by the team rather than run once per thread
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) { A[i] += 1; });
+
+    // reads a neighbor written by the previous loop
+    RAJA::forall<RAJA::omp_parallel_for_static<16>>(
+        RAJA::RangeSegment(0, N),
+        [=](int i) { B[i] = A[(i + 1) % N] + 1; });
+
+    RAJA::kernel<KPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+                       [=](int i) { A[i] += B[N - 1 - i]; });
+  });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(B[i], 2);
+    ASSERT_EQ(A[i], 3);
+  }
+
+  delete[] A;
+  delete[] B;
+}
+
+TEST(Region, fused_nested_loops)
+{
+  const int N = 8;
+  int *A = new int[N * N];
+  int *B = new int[N * N];
+  for (int i = 0; i < N * N; ++i) {
+    A[i] = 0;
+    B[i] = 0;
+  }
+
+  using KPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::omp_parallel_for_exec,
+      RAJA::statement::For<1,
+                           RAJA::omp_parallel_for_exec,
+                           RAJA::statement::Lambda<0>>>>;
+
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+  RAJA::region<RAJA::omp_fused_region>([=]() {
+    // only the outer loops share the team; inner loops run all of their
+    // iterations for each outer iteration
+    RAJA::kernel<KPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                        RAJA::RangeSegment(0, N)),
+                       [=](int i, int j) { A[i * N + j] += 1; });
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N), [=](int i) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, N), [=](int j) { B[i * N + j] += 1; });
+        });
+  });
+  omp_set_num_threads(num_threads);
+
+  for (int i = 0; i < N * N; ++i) {
+    ASSERT_EQ(A[i], 1);
+    ASSERT_EQ(B[i], 1);
+  }
+
+  delete[] A;
+  delete[] B;
+}
+
+TEST(Region, fused_collapse)
+{
+  const int N = 8;
+
+  using KPol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<0, 1>,
+                                RAJA::statement::Lambda<0>>>;
+
+  RAJA::ReduceSum<RAJA::omp_reduce, int> count(0);
+
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+  RAJA::region<RAJA::omp_fused_region>([=]() {
+    // the collapsed nest is shared by the team, not run once per thread
+    RAJA::kernel<KPol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                        RAJA::RangeSegment(0, N)),
+                       [=](int, int) { count += 1; });
+  });
+  omp_set_num_threads(num_threads);
+
+  ASSERT_EQ(count.get(), N * N);
+}
+
+TEST(Region, fused_nowait_sync_reduce)
+{
+  const int N = 10000;
+  const int steps = 5;
+  double *A = new double[N];
+  double *B = new double[N];
+
+  RAJA::ReduceSum<RAJA::omp_reduce, double> sums[steps] = {
+      {0.0}, {0.0}, {0.0}, {0.0}, {0.0}};
+  RAJA::ReduceMax<RAJA::omp_reduce, double> amax(0.0);
+  RAJA::ReduceSum<RAJA::omp_reduce, int> mismatches(0);
+
+  RAJA::ReduceSum<RAJA::omp_reduce, double> *psums = sums;
+
+  RAJA::region<RAJA::omp_fused_region>([=]() {
+    RAJA::forall<RAJA::omp_for_stable_nowait<>>(RAJA::RangeSegment(0, N),
+                                                [=](int i) { A[i] = i; });
+
+    for (int s = 0; s < steps; ++s) {
+      // same index as the previous loop, so no barrier is needed
+      RAJA::forall<RAJA::omp_for_stable_nowait<>>(
+          RAJA::RangeSegment(0, N), [=](int i) {
+            B[i] = A[i] + 1;
+            psums[s] += B[i];
+          });
+
+      // every thread sees the sum of the whole loop
+      double total = RAJA::region_get<RAJA::omp_fused_region>(psums[s]);
+      double expected = 0.5 * N * (N - 1) + double(s + 1) * N;
+      if (total != expected) mismatches += 1;
+
+      // next loop reads other threads' entries of B
+      RAJA::forall<RAJA::omp_for_stable_nowait<>>(
+          RAJA::RangeSegment(0, N), [=](int i) {
+            A[i] = B[N - 1 - i] - (N - 1 - i) + i;
+            amax.max(A[i]);
+          });
+      RAJA::region_sync<RAJA::omp_fused_region>();
+    }
+  });
+
+  ASSERT_EQ(mismatches.get(), 0);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(A[i], double(i + steps));
+  }
+  ASSERT_EQ(amax.get(), double(N - 1 + steps));
+
+  delete[] A;
+  delete[] B;
+}
+#endif
+
+TEST(Region, seq_sync_reduce)
+{
+  RAJA::ReduceSum<RAJA::seq_reduce, int> sum(0);
+  int value = -1;
+  int *pvalue = &value;
+
+  RAJA::region<RAJA::seq_region>([=]() {
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, 10),
+                                  [=](int i) { sum += i; });
+    RAJA::region_sync<RAJA::seq_region>();
+    *pvalue = RAJA::region_get<RAJA::seq_region>(sum);
+  });
+
+  ASSERT_EQ(value, 45);
+}
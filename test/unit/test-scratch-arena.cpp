@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for ScratchArena
+///
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA_gtest.hpp"
+
+template <typename Policy>
+class ScratchArenaTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_CASE_P(ScratchArenaTest);
+
+TYPED_TEST_P(ScratchArenaTest, PerIterationWorkspace)
+{
+  const int N = 10000;
+  const int W = 37;
+  RAJA::ScratchArena<TypeParam> scratch(1024);
+  std::vector<double> out(N);
+  double* o = out.data();
+
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<TypeParam>(RAJA::RangeSegment(0, N), [=](int i) {
+      auto s = scratch.scope();
+      double* w = scratch.template get<double>(W);
+      long* l = scratch.template get<long>(3, 64);
+      l[0] = i;
+      for (int j = 0; j < W; ++j) {
+        w[j] = i + j;
+      }
+      double sum = 0.0;
+      for (int j = 0; j < W; ++j) {
+        sum += w[j];
+      }
+      o[i] = sum + (reinterpret_cast<std::uintptr_t>(l) % 64) + l[0];
+    });
+
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(W * double(i) + W * (W - 1) / 2 + i, out[i]);
+    }
+  }
+
+  // every iteration released its workspace, so each lane holds one block
+  const size_t lanes = std::max<size_t>(RAJA::getMaxOMPThreadsCPU(),
+                                        std::thread::hardware_concurrency());
+  ASSERT_LE(scratch.capacity(), 4096 * (lanes + 1));
+}
+
+TYPED_TEST_P(ScratchArenaTest, ChunkWorkspace)
+{
+  const int N = 20000;
+  RAJA::ScratchArena<TypeParam> scratch(4096);
+  std::vector<int*> ptrs(N);
+  int** p = ptrs.data();
+
+  size_t cap = 0;
+  for (int rep = 0; rep < 4; ++rep) {
+    std::vector<int> bad(N, 0);
+    int* b = bad.data();
+
+    RAJA::forall<TypeParam>(RAJA::RangeSegment(0, N), [=](int i) {
+      int* v = scratch.template get<int>(100);
+      for (int j = 0; j < 100; ++j) {
+        v[j] = i;
+      }
+      p[i] = v;
+      for (int j = 0; j < 100; ++j) {
+        if (v[j] != i) b[i] = 1;
+      }
+    });
+
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(0, bad[i]);
+    }
+    // nothing is released within a chunk, so neighboring iterations run by
+    // the same chunk got separate workspace
+    if (std::is_same<TypeParam, RAJA::seq_exec>::value) {
+      for (int i = 1; i < N; ++i) {
+        ASSERT_TRUE(ptrs[i - 1] + 100 <= ptrs[i]
+                    || ptrs[i] + 100 <= ptrs[i - 1]);
+      }
+    }
+
+    // the workspace is released at the end of every chunk and reused
+    if (rep == 0) {
+      cap = scratch.capacity();
+    } else {
+      ASSERT_LE(scratch.capacity(), 2 * cap);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(ScratchArenaTest,
+                           PerIterationWorkspace,
+                           ChunkWorkspace);
+
+using ScratchTypes = ::testing::Types<RAJA::seq_exec,
+                                      RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                      ,
+                                      RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                      ,
+                                      RAJA::tbb_for_exec
+#endif
+                                      >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(CPU, ScratchArenaTest, ScratchTypes);
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ScratchArena, NestedParallelLoops)
+{
+  const int N = 64;
+  const int W = 100;
+  RAJA::ScratchArena<RAJA::omp_parallel_for_exec> scratch(1024);
+  std::vector<int> bad(N * N, 0);
+  int* b = bad.data();
+
+  const int num_threads = omp_get_max_threads();
+  const int max_levels = omp_get_max_active_levels();
+  omp_set_num_threads(4);
+  omp_set_max_active_levels(2);
+  // thread ids repeat across the inner teams, so each inner thread needs a
+  // lane of its own
+  RAJA::forall<RAJA::omp_parallel_for_exec>(
+      RAJA::RangeSegment(0, N), [=](int i) {
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, N), [=](int j) {
+              auto s = scratch.scope();
+              int* v = scratch.get<int>(W);
+              for (int k = 0; k < W; ++k) {
+                v[k] = i * N + j;
+              }
+              std::this_thread::yield();
+              for (int k = 0; k < W; ++k) {
+                if (v[k] != i * N + j) b[i * N + j] = 1;
+              }
+            });
+      });
+  omp_set_max_active_levels(max_levels);
+  omp_set_num_threads(num_threads);
+
+  for (int i = 0; i < N * N; ++i) {
+    ASSERT_EQ(0, bad[i]);
+  }
+}
+#endif
@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 
 using namespace RAJA;
@@ -259,3 +260,206 @@ TEST(SIMD, TBBAndSimd_MultiLambda)
 }
 
 #endif
+
+TEST(SIMD, RegisterArithmetic)
+{
+  using reg_t = RAJA::simd_register<double, 4>;
+  double x[4] = {1.0, 2.0, 3.0, 4.0};
+  double y[4] = {0.5, 0.5, 0.5, 0.5};
+
+  reg_t a = reg_t::load(x);
+  reg_t b = reg_t::load(y);
+  reg_t c = 2.0 * a + b - a / 2.0;
+  c *= -b;
+
+  double out[4];
+  c.store(out);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_DOUBLE_EQ(out[i], -0.5 * (1.5 * x[i] + 0.5));
+  }
+  ASSERT_DOUBLE_EQ(a.sum(), 10.0);
+  ASSERT_DOUBLE_EQ(a.sum(3), 6.0);
+  ASSERT_DOUBLE_EQ(a.min(), 1.0);
+  ASSERT_DOUBLE_EQ(a.max(2), 2.0);
+
+  // partial loads fill with zeros, partial stores leave memory alone
+  reg_t p = reg_t::load(x, 3);
+  ASSERT_DOUBLE_EQ(p[2], 3.0);
+  ASSERT_DOUBLE_EQ(p[3], 0.0);
+  double z[4] = {9.0, 9.0, 9.0, 9.0};
+  p.store(z, 2);
+  ASSERT_DOUBLE_EQ(z[1], 2.0);
+  ASSERT_DOUBLE_EQ(z[2], 9.0);
+
+  int idx[4] = {3, 0, 2, 1};
+  reg_t g = reg_t::gather(x, idx);
+  ASSERT_DOUBLE_EQ(g[0], 4.0);
+  ASSERT_DOUBLE_EQ(g[3], 2.0);
+  g.scatter(z, idx);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_DOUBLE_EQ(z[i], x[i]);
+  }
+}
+
+TEST(SIMD, VectorExecDaxpy)
+{
+  const double c = 0.5;
+  for (int N : {0, 3, 8, 1001}) {
+    std::vector<double> x(N, 2.0), y(N, 1.0);
+    RAJA::View<double, RAJA::Layout<1>> X(x.data(), N), Y(y.data(), N);
+
+    int calls = 0;
+    RAJA::forall<RAJA::vector_exec<4>>(RAJA::RangeSegment(0, N), [&](
+        RAJA::VectorIndex<RAJA::Index_type, 4> i) {
+      ASSERT_TRUE(i.is_full() || i.first + (RAJA::Index_type)i.size() == N);
+      Y(i) += c * X(i);
+      ++calls;
+    });
+
+    ASSERT_EQ(calls, (N + 3) / 4);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_DOUBLE_EQ(y[i], 2.0);
+    }
+  }
+}
+
+TEST(SIMD, VectorExecIndices)
+{
+  const int N = 13;
+  std::vector<double> a(N + 4, -1.0);
+  double *pa = a.data();
+
+  RAJA::forall<RAJA::vector_exec<8>>(RAJA::RangeSegment(2, N), [=](
+      RAJA::VectorIndex<RAJA::Index_type, 8> i) {
+    auto v = i.indices<double>() * 2.0;
+    v.store(pa + i.first, i.size());
+  });
+
+  for (int i = 0; i < N + 4; ++i) {
+    ASSERT_DOUBLE_EQ(a[i], i >= 2 && i < N ? 2.0 * i : -1.0);
+  }
+}
+
+TEST(SIMD, VectorExecStridedView)
+{
+  const int N = 6, M = 7;
+  std::vector<double> a(N * M), b(N * M, 0.0);
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = i;
+  }
+  RAJA::View<double, RAJA::Layout<2>> A(a.data(), N, M), B(b.data(), N, M);
+
+  // vectorize the column index: contiguous loads and stores
+  // vectorize the row index: strided gather and scatter
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    RAJA::forall<RAJA::vector_exec<4>>(RAJA::RangeSegment(0, M), [=](
+        RAJA::VectorIndex<int, 4> j) { B(i, j) = A(i, j) + 1.0; });
+  });
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, M), [=](int j) {
+    RAJA::forall<RAJA::vector_exec<4>>(RAJA::RangeSegment(0, N), [=](
+        RAJA::VectorIndex<int, 4> i) { B(i, j) *= 2.0; });
+  });
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_DOUBLE_EQ(b[i], 2.0 * (i + 1.0));
+  }
+}
+
+TEST(SIMD, VectorExecList)
+{
+  RAJA::Index_type idx[] = {5, 1, 7};
+  RAJA::ListSegment list(idx, 3);
+  std::vector<double> a(8, 0.0);
+  RAJA::View<double, RAJA::Layout<1>> A(a.data(), 8);
+
+  int calls = 0;
+  RAJA::forall<RAJA::vector_exec<4>>(list, [&](
+      RAJA::VectorIndex<RAJA::Index_type, 4> i) {
+    ASSERT_EQ(i.size(), 3u);
+    ASSERT_FALSE(i.contiguous);
+    A(i) = i.indices<double>();
+    ++calls;
+  });
+
+  ASSERT_EQ(calls, 1);
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_DOUBLE_EQ(a[i], (i == 5 || i == 1 || i == 7) ? i : 0.0);
+  }
+}
+
+template <typename T>
+void runVectorListTest()
+{
+  // blocks of 4: contiguous, gathered, contiguous, gathered remainder
+  std::vector<T> idx = {8, 9, 10, 11, 3, 0, 30, 2, 12, 13, 14, 15, 20, 22};
+  RAJA::TypedListSegment<T> list(idx.data(), idx.size());
+
+  const int n = 32, m = 3;
+  std::vector<double> x(n * m), y(n * m, 0.0);
+  for (int i = 0; i < n * m; ++i) {
+    x[i] = i;
+  }
+  RAJA::View<double, RAJA::Layout<2>> X(x.data(), n, m), Y(y.data(), n, m);
+
+  std::vector<bool> contiguous;
+  RAJA::forall<RAJA::vector_exec<4>>(list, [&](RAJA::VectorIndex<T, 4> i) {
+    contiguous.push_back(i.contiguous);
+    // the list index has stride m in the View
+    for (int j = 0; j < m; ++j) {
+      Y(i, j) += 2.0 * X(i, j) + 1.0;
+    }
+  });
+
+  ASSERT_EQ(contiguous, (std::vector<bool>{true, false, true, false}));
+  std::vector<double> expect(n * m, 0.0);
+  for (T i : idx) {
+    for (int j = 0; j < m; ++j) {
+      expect[i * m + j] = 2.0 * x[i * m + j] + 1.0;
+    }
+  }
+  for (int i = 0; i < n * m; ++i) {
+    ASSERT_DOUBLE_EQ(y[i], expect[i]);
+  }
+}
+
+TEST(SIMD, VectorExecListGather)
+{
+  runVectorListTest<RAJA::Index_type>();
+  runVectorListTest<int>();
+}
+
+TEST(SIMD, GatherScatterWidths)
+{
+  std::vector<double> d(64);
+  std::vector<float> f(64);
+  for (int i = 0; i < 64; ++i) {
+    d[i] = i;
+    f[i] = i;
+  }
+  int idx32[16];
+  long idx64[16];
+  for (int i = 0; i < 16; ++i) {
+    idx32[i] = idx64[i] = (i * 7) % 64;
+  }
+
+  auto d4 = RAJA::simd_register<double, 4>::gather(d.data(), idx64);
+  auto d8 = RAJA::simd_register<double, 8>::gather(d.data(), idx32);
+  auto f8 = RAJA::simd_register<float, 8>::gather(f.data(), idx32);
+  auto f16 = RAJA::simd_register<float, 16>::gather(f.data(), idx32);
+  for (int i = 0; i < 16; ++i) {
+    if (i < 4) {
+      ASSERT_DOUBLE_EQ(d4[i], idx64[i]);
+    }
+    if (i < 8) {
+      ASSERT_DOUBLE_EQ(d8[i], idx32[i]);
+      ASSERT_FLOAT_EQ(f8[i], idx32[i]);
+    }
+    ASSERT_FLOAT_EQ(f16[i], idx32[i]);
+  }
+
+  std::vector<double> out(64, -1.0);
+  (d8 * 2.0).scatter(out.data(), idx64);
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_DOUBLE_EQ(out[idx64[i]], 2.0 * idx64[i]);
+  }
+}